@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <set>
 
 namespace Porkchop {
 
@@ -20,9 +22,16 @@ struct Assembler {
     }
 
     static inline bool debug_flag = false;
+    static inline bool bounds_flag = false;
+    static inline bool trapv_flag = false;
+    static inline bool fast_math_flag = false;
+    bool fast = false; // attach fast-math flags to floating-point instructions of the current function
     std::vector<std::string> debug_info;
     size_t dbg = 10;
     std::vector<std::string> gves;
+    std::set<std::string> declarations;
+    size_t arrays = 0;
+    std::string weights[2];
 
     void init_debug(std::string const& filename, std::string const& directory) {
         if (!debug_flag) return;
@@ -73,6 +82,17 @@ struct Assembler {
             sprintf(buf, "!DIDerivedType(tag: DW_TAG_pointer_type, baseType: %s, size: 64)", typeOf(ptr->E).data());
             return debug(buf);
         }
+        if (auto slice = dynamic_cast<SliceType*>(type.get())) {
+            char buf[192];
+            sprintf(buf, "!DIDerivedType(tag: DW_TAG_member, name: \"ptr\", baseType: %s, size: 64)",
+                    typeOf(std::make_shared<PointerType>(slice->E)).data());
+            auto ptr = debug(buf);
+            sprintf(buf, "!DIDerivedType(tag: DW_TAG_member, name: \"len\", baseType: %s, size: 64, offset: 64)", DEBUG::INT);
+            auto len = debug(buf);
+            sprintf(buf, "!DICompositeType(tag: DW_TAG_structure_type, name: %s, size: 128, elements: %s)",
+                    quote(type->toString()).data(), DEBUG::listOf({ptr, len}).data());
+            return debug(buf);
+        }
         if (auto func = dynamic_pointer_cast<FuncType>(type)) {
             char buf[64];
             sprintf(buf, "!DIDerivedType(tag: DW_TAG_pointer_type, baseType: %s, size: 64)", prototypeOf(func).data());
@@ -86,8 +106,16 @@ struct Assembler {
                     return DEBUG::INT;
                 case ScalarTypeKind::FLOAT:
                     return DEBUG::FLOAT;
-                default:
+                case ScalarTypeKind::NONE:
+                case ScalarTypeKind::NEVER:
                     return DEBUG::NONE;
+                default: {
+                    char buf[96];
+                    const char* encoding = isFloating(type) ? "DW_ATE_float" : isUnsigned(type) ? "DW_ATE_unsigned" : "DW_ATE_signed";
+                    sprintf(buf, "!DIBasicType(name: \"%s\", size: %lld, encoding: %s)",
+                            scalar->descriptor().data(), (long long) type->size() * 8, encoding);
+                    return debug(buf);
+                }
             }
         }
         return DEBUG::NONE;
@@ -146,8 +174,31 @@ struct Assembler {
         return std::to_string(i);
     }
 
+    [[nodiscard]] static std::string hex(double d) {
+        char buf[24];
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof bits);
+        sprintf(buf, "0x%016llX", (unsigned long long) bits);
+        return buf;
+    }
+
     [[nodiscard]] static std::string const_(double d) {
-        return std::to_string(d);
+        // fall back to hexadecimal form if the decimal one is not exact
+        auto decimal = std::to_string(d);
+        if (std::isfinite(d) && std::stod(decimal) == d) return decimal;
+        return hex(d);
+    }
+
+    [[nodiscard]] static std::string const_(float f) {
+        // single-precision constants must be exact, so emit them in hexadecimal form
+        return hex(f);
+    }
+
+    [[nodiscard]] static std::string const_($union value, const TypeReference& type) {
+        if (isBool(type)) return const_(value.$bool);
+        if (isIntegral(type)) return const_(value.$int);
+        if (isScalar(type, ScalarTypeKind::F32)) return const_((float) value.$float);
+        return const_(value.$float);
     }
 
     static std::string escape(std::string_view source) {
@@ -234,33 +285,101 @@ struct Assembler {
         append(buf, token);
     }
 
+    [[nodiscard]] std::string atomicLoad(std::string const& from, const TypeReference& type, const char* order, Token token) {
+        char buf[96];
+        auto name = type->serialize();
+        auto index = next();
+        sprintf(buf, "%s = load atomic %s, ptr %s %s, align %d", index.data(), name.data(), from.data(), order, (int) type->size());
+        append(buf, token);
+        return index;
+    }
+
+    void atomicStore(std::string const& from, std::string const& into, const TypeReference& type, const char* order, Token token) {
+        char buf[96];
+        auto name = type->serialize();
+        sprintf(buf, "store atomic %s %s, ptr %s %s, align %d", name.data(), from.data(), into.data(), order, (int) type->size());
+        append(buf, token);
+    }
+
+    [[nodiscard]] std::string atomicrmw(const char* op, std::string const& ptr, std::string const& value, const TypeReference& type, const char* order, Token token) {
+        char buf[96];
+        auto name = type->serialize();
+        auto index = next();
+        sprintf(buf, "%s = atomicrmw %s ptr %s, %s %s %s, align %d", index.data(), op, ptr.data(), name.data(), value.data(), order, (int) type->size());
+        append(buf, token);
+        return index;
+    }
+
+    [[nodiscard]] std::string cmpxchg(std::string const& ptr, std::string const& expected, std::string const& desired, const TypeReference& type,
+                                      const char* success, const char* failure, Token token) {
+        char buf[128];
+        auto name = type->serialize();
+        auto pair = next();
+        sprintf(buf, "%s = cmpxchg ptr %s, %s %s, %s %s %s %s, align %d", pair.data(), ptr.data(),
+                name.data(), expected.data(), name.data(), desired.data(), success, failure, (int) type->size());
+        append(buf, token);
+        auto index = next();
+        sprintf(buf, "%s = extractvalue { %s, i1 } %s, 0", index.data(), name.data(), pair.data());
+        append(buf, token);
+        return index;
+    }
+
+    void fence(const char* order, Token token) {
+        char buf[32];
+        sprintf(buf, "fence %s", order);
+        append(buf, token);
+    }
+
+    [[nodiscard]] const char* fastMath(const TypeReference& type) const {
+        return fast && isFloating(type) ? " fast" : "";
+    }
+
     [[nodiscard]] std::string infix(const char* op, std::string const& lhs, std::string const& rhs, const TypeReference& type, Token token) {
-        char buf[64];
+        char buf[128];
         auto name = type->serialize();
         auto index = next();
-        sprintf(buf, "%s = %s %s %s, %s", index.data(), op, name.data(), lhs.data(), rhs.data());
+        sprintf(buf, "%s = %s%s %s %s, %s", index.data(), op, fastMath(type), name.data(), lhs.data(), rhs.data());
         append(buf, token);
         return index;
     }
 
+    // returns the wrapped result and whether the signed operation overflowed
+    [[nodiscard]] std::pair<std::string, std::string> overflow(const char* op, std::string const& lhs, std::string const& rhs, const TypeReference& type, Token token) {
+        char buf[128];
+        auto name = type->serialize();
+        sprintf(buf, "declare { %s, i1 } @llvm.s%s.with.overflow.%s(%s, %s)", name.data(), op, name.data(), name.data(), name.data());
+        declarations.emplace(buf);
+        auto pair = next();
+        sprintf(buf, "%s = call { %s, i1 } @llvm.s%s.with.overflow.%s(%s %s, %s %s)", pair.data(), name.data(), op, name.data(),
+                name.data(), lhs.data(), name.data(), rhs.data());
+        append(buf, token);
+        auto value = next();
+        sprintf(buf, "%s = extractvalue { %s, i1 } %s, 0", value.data(), name.data(), pair.data());
+        append(buf, token);
+        auto overflowed = next();
+        sprintf(buf, "%s = extractvalue { %s, i1 } %s, 1", overflowed.data(), name.data(), pair.data());
+        append(buf, token);
+        return {value, overflowed};
+    }
+
     [[nodiscard]] std::string neg(std::string const& rhs, const TypeReference& type, Token token) {
-        if (isInt(type)) {
+        if (isIntegral(type)) {
             return infix("sub", "0", rhs, type, token);
         } else {
             char buf[64];
             auto name = type->serialize();
             auto index = next();
-            sprintf(buf, "%s = fneg %s %s", index.data(), name.data(), rhs.data());
+            sprintf(buf, "%s = fneg%s %s %s", index.data(), fastMath(type), name.data(), rhs.data());
             append(buf, token);
             return index;
         }
     }
 
     [[nodiscard]] std::string compare(const char* op1, const char* op2, std::string const& lhs, std::string const& rhs, const TypeReference& type, Token token) {
-        char buf[64];
+        char buf[128];
         auto name = type->serialize();
         auto index = next();
-        sprintf(buf, "%s = %s %s %s %s, %s", index.data(), op1, op2, name.data(), lhs.data(), rhs.data());
+        sprintf(buf, "%s = %s%s %s %s %s, %s", index.data(), op1, fastMath(type), op2, name.data(), lhs.data(), rhs.data());
         append(buf, token);
         return index;
     }
@@ -274,6 +393,39 @@ struct Assembler {
         return index;
     }
 
+    [[nodiscard]] std::string extract(std::string const& aggregate, const TypeReference& type, size_t position, Token token) {
+        char buf[64];
+        auto name = type->serialize();
+        auto index = next();
+        sprintf(buf, "%s = extractvalue %s %s, %zu", index.data(), name.data(), aggregate.data(), position);
+        append(buf, token);
+        return index;
+    }
+
+    [[nodiscard]] std::string slice(std::string const& ptr, std::string const& length, Token token) {
+        char buf[64];
+        auto partial = next();
+        sprintf(buf, "%s = insertvalue { ptr, i64 } undef, ptr %s, 0", partial.data(), ptr.data());
+        append(buf, token);
+        auto index = next();
+        sprintf(buf, "%s = insertvalue { ptr, i64 } %s, i64 %s, 1", index.data(), partial.data(), length.data());
+        append(buf, token);
+        return index;
+    }
+
+    void assume(std::string const& cond, Token token) {
+        char buf[64];
+        declarations.emplace("declare void @llvm.assume(i1 noundef)");
+        sprintf(buf, "call void @llvm.assume(i1 %s)", cond.data());
+        append(buf, token);
+    }
+
+    void trap(Token token) {
+        declarations.emplace("declare void @llvm.trap() cold noreturn nounwind");
+        append("call void @llvm.trap()", token);
+        append("unreachable");
+    }
+
     void return_(std::string const& from, const TypeReference& type, Token token) {
         if (isNone(type)) {
             append("ret void", token);
@@ -285,10 +437,33 @@ struct Assembler {
         append(buf, token);
     }
 
-    void br(std::string const& cond, size_t L1, size_t L2) {
+    void br(std::string const& cond, size_t L1, size_t L2, std::optional<bool> likely = std::nullopt) {
         char buf[64];
         sprintf(buf, "br i1 %s, label %%L%zu, label %%L%zu", cond.data(), L1, L2);
         append(buf);
+        if (likely) {
+            auto& weight = weights[*likely];
+            if (weight.empty()) {
+                // the same weights as clang gives to __builtin_expect
+                weight = debug(*likely ? "!{!\"branch_weights\", i32 2000, i32 1}" : "!{!\"branch_weights\", i32 1, i32 2000}");
+            }
+            assemblies.back() += ", !prof ";
+            assemblies.back() += weight;
+        }
+    }
+
+    void switch_(std::string const& cond, const TypeReference& type, size_t otherwise, std::vector<std::pair<std::string, size_t>> const& cases, Token token) {
+        char buf[64];
+        auto name = type->serialize();
+        sprintf(buf, "switch %s %s, label %%L%zu [", name.data(), cond.data(), otherwise);
+        append(buf);
+        indent += 4;
+        for (auto&& [value, L] : cases) {
+            sprintf(buf, "%s %s, label %%L%zu", name.data(), value.data(), L);
+            append(buf);
+        }
+        indent -= 4;
+        append("]", token);
     }
 
     void br(size_t L) {
@@ -320,17 +495,17 @@ struct Assembler {
 
     void write(FILE* file) {
         if (debug_flag)
-            assemblies.emplace_back("declare void @llvm.dbg.declare(metadata, metadata, metadata)");
+            declarations.emplace("declare void @llvm.dbg.declare(metadata, metadata, metadata)");
+        assemblies.insert(assemblies.end(), declarations.begin(), declarations.end());
         for (auto&& line : assemblies) {
             fputs(line.c_str(), file);
             fputs("\n", file);
         }
-        if (debug_flag) {
+        if (debug_flag)
             debug_info.emplace_back(DEBUG::GLOBALS + (" = " + DEBUG::listOf(gves)));
-            for (auto&& line : debug_info) {
-                fputs(line.c_str(), file);
-                fputs("\n", file);
-            }
+        for (auto&& line : debug_info) {
+            fputs(line.c_str(), file);
+            fputs("\n", file);
         }
     }
 };
@@ -1,3 +1,5 @@
+#include <unordered_set>
+
 #include "parser.hpp"
 #include "compiler.hpp"
 #include "assembler.hpp"
@@ -33,28 +35,266 @@ void Compiler::parse() {
     LocalContext context(global);
     Parser parser(*this, source.tokens.begin(), source.tokens.end(), context);
     parser.parseFile();
+    inferAttributes();
+    exportConstants();
+}
+
+struct Effects {
+    bool reads = false;   // reads memory other than its own locals
+    bool writes = false;  // writes memory other than its own locals
+    bool unknown = false; // calls through a function pointer
+    bool loops = false;   // contains a loop which may not terminate
+    bool traps = false;   // contains a runtime check which may abort
+    std::unordered_set<std::string> callees;
+};
+
+bool isShared(const AssignableExpr* expr) {
+    if (auto id = dynamic_cast<const IdExpr*>(expr)) {
+        return id->lookup.scope == LocalContext::LookupResult::Scope::GLOBAL;
+    }
+    return true;
+}
+
+void collectCallee(const Expr* callee, Effects& effects) {
+    if (auto id = dynamic_cast<const IdExpr*>(callee);
+            id && id->lookup.scope == LocalContext::LookupResult::Scope::GLOBAL && isFunction(id->getType())) {
+        effects.callees.emplace(id->compiler.of(id->token));
+    } else {
+        effects.unknown = true;
+    }
+}
+
+bool mayOverflow(const Descriptor* node) {
+    auto overflows = [](TokenType type) {
+        switch (type) {
+            case TokenType::OP_ADD:
+            case TokenType::OP_SUB:
+            case TokenType::OP_MUL:
+            case TokenType::OP_SHL:
+            case TokenType::OP_ASSIGN_ADD:
+            case TokenType::OP_ASSIGN_SUB:
+            case TokenType::OP_ASSIGN_MUL:
+            case TokenType::OP_ASSIGN_SHL:
+                return true;
+            default:
+                return false;
+        }
+    };
+    if (auto infix = dynamic_cast<const InfixExpr*>(node)) {
+        return overflows(infix->token.type) && isSigned(infix->getType());
+    } else if (auto assign = dynamic_cast<const AssignExpr*>(node)) {
+        return overflows(assign->token.type) && isSigned(assign->getType());
+    } else if (auto prefix = dynamic_cast<const PrefixExpr*>(node)) {
+        return prefix->token.type == TokenType::OP_SUB && isSigned(prefix->getType());
+    } else if (auto prefix = dynamic_cast<const StatefulPrefixExpr*>(node)) {
+        return isSigned(prefix->getType());
+    } else if (auto postfix = dynamic_cast<const StatefulPostfixExpr*>(node)) {
+        return isSigned(postfix->getType());
+    }
+    return false;
+}
+
+void collectEffects(const Descriptor* node, Effects& effects) {
+    if (auto id = dynamic_cast<const IdExpr*>(node)) {
+        if (id->lookup.scope == LocalContext::LookupResult::Scope::GLOBAL && !isFunction(id->getType()) && !id->isConstantArray() && !id->isConst()) {
+            effects.reads = true;
+        }
+    } else if (dynamic_cast<const DereferenceExpr*>(node) || dynamic_cast<const AccessExpr*>(node)) {
+        effects.reads = true;
+    } else if (auto assign = dynamic_cast<const AssignExpr*>(node)) {
+        effects.writes |= isShared(assign->lhs.get());
+    } else if (auto prefix = dynamic_cast<const StatefulPrefixExpr*>(node)) {
+        effects.writes |= isShared(prefix->rhs.get());
+    } else if (auto postfix = dynamic_cast<const StatefulPostfixExpr*>(node)) {
+        effects.writes |= isShared(postfix->lhs.get());
+    } else if (auto invoke = dynamic_cast<const InvokeExpr*>(node)) {
+        collectCallee(invoke->lhs.get(), effects);
+    } else if (auto invoke = dynamic_cast<const InfixInvokeExpr*>(node)) {
+        collectCallee(invoke->infix.get(), effects);
+    } else if (auto builtin = dynamic_cast<const BuiltinExpr*>(node)) {
+        switch (builtin->builtin) {
+            case Builtin::LIKELY:
+            case Builtin::UNLIKELY:
+            case Builtin::ASSUME:
+            case Builtin::UNREACHABLE:
+            case Builtin::LEN:
+            case Builtin::WRAPPING_ADD:
+            case Builtin::WRAPPING_SUB:
+            case Builtin::WRAPPING_MUL:
+            case Builtin::WRAPPING_SHL:
+                break;
+            case Builtin::PREFETCH:
+                effects.reads = true;
+                break;
+            default:
+                // ordered atomics synchronize with other threads, so only a relaxed load is a pure read
+                effects.reads = true;
+                effects.writes |= builtin->builtin != Builtin::ATOMIC_LOAD || builtin->memoryOrder() != MemoryOrder::RELAXED;
+                break;
+        }
+    } else if (dynamic_cast<const WhileExpr*>(node)) {
+        effects.loops = true;
+    }
+    if (Assembler::bounds_flag) {
+        if (auto access = dynamic_cast<const AccessExpr*>(node); access && isSlice(access->lhs->getType())
+                || dynamic_cast<const SliceExpr*>(node)) {
+            effects.traps = true;
+        }
+    }
+    if (Assembler::trapv_flag && mayOverflow(node)) {
+        effects.traps = true;
+    }
+    for (auto&& child : node->children()) {
+        if (dynamic_cast<const Expr*>(child)) {
+            collectEffects(child, effects);
+        }
+    }
+}
+
+void Compiler::inferAttributes() const {
+    struct Summary {
+        Effects effects;
+        FuncType* prototype;
+        bool nounwind, willreturn, norecurse;
+    };
+    std::unordered_map<std::string, Summary> summaries;
+    for (auto&& fn : global->fns) {
+        if (!fn->definition) continue;
+        Summary summary{.prototype = fn->parameters->prototype.get()};
+        collectEffects(fn->definition->clause.get(), summary.effects);
+        summaries.emplace(of(fn->name->token), std::move(summary));
+    }
+    auto reaches = [&](std::string const& from, std::string const& to) {
+        std::unordered_set<std::string> visited;
+        std::vector<std::string> stack{from};
+        while (!stack.empty()) {
+            auto name = std::move(stack.back());
+            stack.pop_back();
+            auto it = summaries.find(name);
+            if (it == summaries.end()) continue;
+            for (auto&& callee : it->second.effects.callees) {
+                if (callee == to) return true;
+                if (visited.insert(callee).second) stack.push_back(callee);
+            }
+        }
+        return false;
+    };
+    for (auto&& [name, summary] : summaries) {
+        auto& effects = summary.effects;
+        bool recursive = reaches(name, name);
+        summary.nounwind = !effects.unknown;
+        summary.norecurse = !effects.unknown && !recursive;
+        summary.willreturn = !effects.unknown && !recursive && !effects.loops && !effects.traps && !isNever(summary.prototype->R);
+        if (effects.unknown) effects.reads = effects.writes = true;
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto&& [name, summary] : summaries) {
+            auto& effects = summary.effects;
+            bool reads = effects.reads, writes = effects.writes;
+            bool nounwind = summary.nounwind, willreturn = summary.willreturn, norecurse = summary.norecurse;
+            for (auto&& callee : effects.callees) {
+                if (auto it = summaries.find(callee); it != summaries.end()) {
+                    reads |= it->second.effects.reads;
+                    writes |= it->second.effects.writes;
+                    nounwind &= it->second.nounwind;
+                    willreturn &= it->second.willreturn;
+                    norecurse &= it->second.norecurse;
+                } else {
+                    auto prototype = dynamic_cast<FuncType*>(global->global.at(callee).get());
+                    reads |= !prototype->has(FunctionAttribute::READNONE);
+                    writes |= !prototype->has(FunctionAttribute::READNONE) && !prototype->has(FunctionAttribute::READONLY);
+                    nounwind &= prototype->has(FunctionAttribute::NOUNWIND);
+                    willreturn &= prototype->has(FunctionAttribute::WILLRETURN);
+                    norecurse &= prototype->has(FunctionAttribute::NORECURSE);
+                }
+            }
+            if (reads != effects.reads || writes != effects.writes || nounwind != summary.nounwind
+                || willreturn != summary.willreturn || norecurse != summary.norecurse) {
+                effects.reads = reads;
+                effects.writes = writes;
+                summary.nounwind = nounwind;
+                summary.willreturn = willreturn;
+                summary.norecurse = norecurse;
+                changed = true;
+            }
+        }
+    }
+    for (auto&& [name, summary] : summaries) {
+        auto prototype = summary.prototype;
+        if (!summary.effects.reads && !summary.effects.writes) {
+            prototype->add(FunctionAttribute::READNONE);
+        } else if (!summary.effects.writes) {
+            prototype->add(FunctionAttribute::READONLY);
+        }
+        if (summary.nounwind) prototype->add(FunctionAttribute::NOUNWIND);
+        if (summary.willreturn) prototype->add(FunctionAttribute::WILLRETURN);
+        if (summary.norecurse) prototype->add(FunctionAttribute::NORECURSE);
+    }
+}
+
+void collectModified(const Descriptor* node, std::unordered_set<std::string>& modified) {
+    const Expr* target = nullptr;
+    if (auto assign = dynamic_cast<const AssignExpr*>(node)) {
+        target = assign->lhs.get();
+    } else if (auto prefix = dynamic_cast<const StatefulPrefixExpr*>(node)) {
+        target = prefix->rhs.get();
+    } else if (auto postfix = dynamic_cast<const StatefulPostfixExpr*>(node)) {
+        target = postfix->lhs.get();
+    } else if (auto address = dynamic_cast<const AddressOfExpr*>(node)) {
+        target = address->rhs.get();
+    }
+    if (auto id = dynamic_cast<const IdExpr*>(target); id && id->lookup.scope == LocalContext::LookupResult::Scope::GLOBAL) {
+        modified.emplace(id->compiler.of(id->token));
+    }
+    for (auto&& child : node->children()) {
+        if (dynamic_cast<const Expr*>(child)) {
+            collectModified(child, modified);
+        }
+    }
+}
+
+void Compiler::exportConstants() const {
+    std::unordered_set<std::string> modified;
+    for (auto&& fn : global->fns) {
+        if (fn->definition) {
+            collectModified(fn->definition->clause.get(), modified);
+        }
+    }
+    for (auto&& let : global->lets) {
+        std::string name(of(let->declarator->name->token));
+        auto it = global->exportedLets.find(name);
+        if (it == global->exportedLets.end() || it->second.length || modified.contains(name)) continue;
+        it->second.value = let->initializer->requireConst();
+    }
 }
 
 void Compiler::compileLet(LetExpr *let, Assembler *assembler) const {
+    std::string_view name(of(let->declarator->name->token));
+    if (auto array = dynamic_cast<ArrayExpr*>(let->initializer.get())) {
+        assembler->append(Assembler::escape(name) + " = " + array->definition(assembler));
+        return;
+    }
     auto initial = let->initializer->requireConst();
     auto type = let->initializer->getType();
-    std::string_view name(of(let->declarator->name->token));
-    std::string value;
-    if (isBool(type)) {
-        value = assembler->const_(initial.$bool);
-    } else if (isInt(type)) {
-        value = assembler->const_(initial.$int);
-    } else if (isFloat(type)) {
-        value = assembler->const_(initial.$float);
-    } else {
+    if (!isBool(type) && !isArithmetic(type)) {
         raise("PorkchopLite does not support let of none type", let->segment());
     }
-    assembler->global(Assembler::escape(name), type, value, let->token.line);
+    assembler->global(Assembler::escape(name), type, assembler->const_(initial, type), let->token.line);
+}
+
+std::string_view extensionOf(TypeReference const& type) {
+    if (isIntegral(type) && type->size() < 4) {
+        return isUnsigned(type) ? "zeroext " : "signext ";
+    }
+    return "";
 }
 
 std::string fnHeader(bool definition, std::string_view name, std::shared_ptr<FuncType> const& prototype) {
     std::string declare(definition ? "define" : "declare");
     declare += " ";
+    declare += extensionOf(prototype->R);
     declare += prototype->R->serialize();
     declare += " ";
     std::string identifier = Assembler::escape(name);
@@ -67,9 +307,18 @@ std::string fnHeader(bool definition, std::string_view name, std::shared_ptr<Fun
         }
         declare += param->serialize();
         declare += " ";
+        declare += extensionOf(param);
+        if (prototype->isRestrict(index)) declare += "noalias ";
         declare += Assembler::regOf(index++);
     }
     declare += ")";
+    for (size_t i = 0; i < std::size(FUNCTION_ATTRIBUTE_NAME); ++i) {
+        if (i == (size_t) FunctionAttribute::READONLY && prototype->has(FunctionAttribute::READNONE)) continue;
+        if (prototype->has(FunctionAttribute(i))) {
+            declare += " ";
+            declare += FUNCTION_ATTRIBUTE_NAME[i];
+        }
+    }
     return declare;
 }
 
@@ -96,6 +345,7 @@ void Compiler::compileFn(FunctionDeclarator* fn, Assembler* assembler) const {
     assembler->append(declare);
     if (definition) {
         assembler->reg = index;
+        assembler->fast = Assembler::fast_math_flag || definition->fast;
         assembler->indent += 4;
         global->labelUntil = 0;
         assembler->label(global->labelUntil++);
@@ -110,6 +360,14 @@ void Compiler::compileFn(FunctionDeclarator* fn, Assembler* assembler) const {
                 ++param;
             }
         }
+        for (param = 0; param < index; ++param) {
+            auto type = fn->parameters->prototype->P[param];
+            if (!isSlice(type)) continue;
+            // a known non-negative length lets loops bounded by it be analyzed as counted loops
+            auto token = fn->parameters->identifiers[param]->token;
+            auto length = assembler->extract(Assembler::regOf(param), type, 1, token);
+            assembler->assume(assembler->compare("icmp", "sge", length, "0", ScalarTypes::INT, token), token);
+        }
         definition->clause->walkBytecode(assembler);
         if (!isNever(definition->clause->getType())) {
             auto segment =  fn->definition->clause->segment();
@@ -125,6 +383,18 @@ void Compiler::compile(Assembler* assembler) const {
     for (auto&& let : global->lets) {
         compileLet(let.get(), assembler);
     }
+    for (auto&& [key, let] : global->importedLets) {
+        // constants are inlined into every use, so only variables and arrays are linked
+        if (let.value) continue;
+        auto type = let.length ? dynamic_cast<PointerType*>(let.type.get())->E : let.type;
+        char buf[64];
+        if (let.length) {
+            sprintf(buf, " = external unnamed_addr constant [%zu x %s]", let.length, type->serialize().data());
+        } else {
+            sprintf(buf, " = external global %s", type->serialize().data());
+        }
+        assembler->append(Assembler::escape(key) + buf);
+    }
     for (auto&& [key, prototype] : global->imports) {
         assembler->append(Porkchop::fnHeader(false, key, prototype));
     }
@@ -23,6 +23,8 @@ struct Compiler: Descriptor {
     [[nodiscard]] std::string_view of(Token token) const noexcept;
 
     void parse();
+    void inferAttributes() const;
+    void exportConstants() const;
 
     void compile(Assembler* assembler) const;
     void compileLet(LetExpr* let, Assembler* assembler) const;
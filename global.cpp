@@ -36,7 +36,11 @@ FILE* open(const char *filename, const char *mode, Compiler& compiler, Token tok
 }
 
 std::unordered_set<fs::path> pending;
-std::unordered_map<fs::path, std::unordered_map<std::string, std::shared_ptr<FuncType>>> cache;
+struct Exports {
+    std::unordered_map<std::string, std::shared_ptr<FuncType>> fns;
+    std::unordered_map<std::string, ExportedLet> lets;
+};
+std::unordered_map<fs::path, Exports> cache;
 
 void GlobalScope::import_(std::string const& filename, bool exported, Compiler& parent, Token token) {
     auto file = path.parent_path() / filename;
@@ -51,16 +55,26 @@ void GlobalScope::import_(std::string const& filename, bool exported, Compiler&
         GlobalScope child(path);
         Compiler compiler(&child, std::move(source));
         parse(compiler);
-        cache.emplace(file, std::move(child.exports));
+        cache.emplace(file, Exports{std::move(child.exports), std::move(child.exportedLets)});
         pending.erase(file);
     }
-    for (auto&& [key, prototype] : cache[file]) {
+    for (auto&& [key, prototype] : cache[file].fns) {
         global.emplace(key, prototype);
         imports.emplace(key, prototype);
         if (exported) {
             exports.emplace(key, prototype);
         }
     }
+    for (auto&& [key, let] : cache[file].lets) {
+        global.emplace(key, let.type);
+        importedLets.emplace(key, let);
+        if (let.length) {
+            arrays.emplace(key);
+        }
+        if (exported) {
+            exportedLets.emplace(key, let);
+        }
+    }
 }
 
 
@@ -3,6 +3,8 @@
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <optional>
+#include <unordered_set>
 
 namespace fs = std::filesystem;
 
@@ -15,6 +17,12 @@ struct FunctionDeclarator;
 struct LetExpr;
 
 
+struct ExportedLet {
+    TypeReference type;
+    std::optional<$union> value; // known if the exporting file never modifies it
+    size_t length = 0; // number of elements if it is a constant array
+};
+
 struct GlobalScope {
     std::vector<std::unique_ptr<FunctionDeclarator>> fns;
     std::vector<std::unique_ptr<LetExpr>> lets;
@@ -22,6 +30,9 @@ struct GlobalScope {
     std::unordered_map<std::string, TypeReference> global;
     std::unordered_map<std::string, std::shared_ptr<FuncType>> imports;
     std::unordered_map<std::string, std::shared_ptr<FuncType>> exports;
+    std::unordered_map<std::string, ExportedLet> importedLets;
+    std::unordered_map<std::string, ExportedLet> exportedLets;
+    std::unordered_set<std::string> arrays;
 
     size_t labelUntil = 0;
     fs::path path;
@@ -0,0 +1,237 @@
+#include <algorithm>
+
+#include "interpreter.hpp"
+#include "global.hpp"
+
+namespace Porkchop {
+
+namespace {
+
+struct Unsupported {};
+
+Interpreter* running = nullptr;
+
+struct Break {
+    const LoopExpr* loop;
+};
+
+struct Return {
+    $union value;
+};
+
+TokenType compoundOf(TokenType type) {
+    switch (type) {
+        case TokenType::OP_ASSIGN_AND: return TokenType::OP_AND;
+        case TokenType::OP_ASSIGN_XOR: return TokenType::OP_XOR;
+        case TokenType::OP_ASSIGN_OR: return TokenType::OP_OR;
+        case TokenType::OP_ASSIGN_SHL: return TokenType::OP_SHL;
+        case TokenType::OP_ASSIGN_SHR: return TokenType::OP_SHR;
+        case TokenType::OP_ASSIGN_USHR: return TokenType::OP_USHR;
+        case TokenType::OP_ASSIGN_ADD: return TokenType::OP_ADD;
+        case TokenType::OP_ASSIGN_SUB: return TokenType::OP_SUB;
+        case TokenType::OP_ASSIGN_MUL: return TokenType::OP_MUL;
+        case TokenType::OP_ASSIGN_DIV: return TokenType::OP_DIV;
+        case TokenType::OP_ASSIGN_REM: return TokenType::OP_REM;
+        default: unreachable();
+    }
+}
+
+$union infix(TokenType op, TypeReference const& type, $union value1, $union value2, Segment segment) {
+    // leave division by zero and overflow to the runtime, since the call may never happen
+    if ((op == TokenType::OP_DIV || op == TokenType::OP_REM) && isIntegral(type)
+        && (value2.$size == 0 || (!isUnsigned(type) && value1.$int == INT64_MIN && value2.$int == -1))) {
+        throw Unsupported{};
+    }
+    return InfixExpr::apply(op, type, value1, value2, segment);
+}
+
+}
+
+std::optional<$union> Interpreter::evaluate(GlobalScope* global, const Expr* callee, std::vector<$union> const& args) {
+    if (running) return running->invoke(callee, args);
+    Interpreter interpreter(global);
+    running = &interpreter;
+    struct Guard {
+        ~Guard() {
+            running = nullptr;
+        }
+    } guard;
+    return interpreter.invoke(callee, args);
+}
+
+std::optional<$union> Interpreter::invoke(const Expr* callee, std::vector<$union> const& args) {
+    try {
+        return call(callee, args);
+    } catch (Unsupported&) {
+        return std::nullopt;
+    }
+}
+
+$union Interpreter::call(const Expr* callee, std::vector<$union> const& args) {
+    auto id = dynamic_cast<const IdExpr*>(callee);
+    if (!id || id->lookup.scope != LocalContext::LookupResult::Scope::GLOBAL) throw Unsupported{};
+    auto name = id->compiler.of(id->token);
+    auto it = std::find_if(global->fns.begin(), global->fns.end(), [&](auto&& fn) {
+        return fn->definition && fn->name->compiler.of(fn->name->token) == name;
+    });
+    if (it == global->fns.end() || depth == MAX_DEPTH) throw Unsupported{};
+    auto definition = (*it)->definition.get();
+    Frame callee_{std::vector<$union>(definition->locals.size()), args.size()};
+    std::copy(args.begin(), args.end(), callee_.locals.begin());
+    auto caller = frame;
+    frame = &callee_;
+    ++depth;
+    struct Guard {
+        Interpreter* interpreter;
+        Frame* caller;
+        ~Guard() {
+            interpreter->frame = caller;
+            --interpreter->depth;
+        }
+    } guard{this, caller};
+    try {
+        return eval(definition->clause.get());
+    } catch (Return& ret) {
+        return ret.value;
+    }
+}
+
+$union Interpreter::element(const Expr* array, int64_t index) {
+    // constant arrays are the only memory which is readable at compile-time
+    auto id = dynamic_cast<const IdExpr*>(array);
+    if (!id || !id->isConstantArray()) throw Unsupported{};
+    auto name = id->compiler.of(id->token);
+    for (auto&& let : global->lets) {
+        if (let->declarator->name->compiler.of(let->declarator->name->token) != name) continue;
+        auto& elements = dynamic_cast<const ArrayExpr*>(let->initializer.get())->elements;
+        if (index < 0 || index >= (int64_t) elements.size()) throw Unsupported{};
+        return elements[index]->requireConst();
+    }
+    throw Unsupported{};
+}
+
+$union& Interpreter::local(const IdExpr* id) {
+    if (id->lookup.scope != LocalContext::LookupResult::Scope::LOCAL) throw Unsupported{};
+    return frame->locals[id->lookup.index - frame->offset];
+}
+
+$union Interpreter::eval(const Expr* expr) {
+    if (++steps > MAX_STEPS) throw Unsupported{};
+    if (expr->isConst()) return expr->requireConst();
+    if (auto access = dynamic_cast<const AccessExpr*>(expr)) {
+        return element(access->lhs.get(), eval(access->rhs.get()).$int);
+    }
+    auto type = expr->getType();
+    if (isPointer(type) || isSlice(type) || isFunction(type)) throw Unsupported{};
+    if (auto id = dynamic_cast<const IdExpr*>(expr)) {
+        return local(id);
+    } else if (auto prefix = dynamic_cast<const PrefixExpr*>(expr)) {
+        return prefix->apply(eval(prefix->rhs.get()));
+    } else if (auto prefix = dynamic_cast<const StatefulPrefixExpr*>(expr)) {
+        auto id = dynamic_cast<const IdExpr*>(prefix->rhs.get());
+        if (!id) throw Unsupported{};
+        auto& value = local(id);
+        value = truncate(type, value.$size + (prefix->token.type == TokenType::OP_INC ? 1 : -1));
+        return value;
+    } else if (auto postfix = dynamic_cast<const StatefulPostfixExpr*>(expr)) {
+        auto id = dynamic_cast<const IdExpr*>(postfix->lhs.get());
+        if (!id) throw Unsupported{};
+        auto& value = local(id);
+        auto old = value;
+        value = truncate(type, value.$size + (postfix->token.type == TokenType::OP_INC ? 1 : -1));
+        return old;
+    } else if (auto infix = dynamic_cast<const InfixExpr*>(expr)) {
+        auto type1 = infix->lhs->getType();
+        if (isPointer(type1) || isPointer(infix->rhs->getType())) throw Unsupported{};
+        auto value1 = eval(infix->lhs.get());
+        auto value2 = eval(infix->rhs.get());
+        return Porkchop::infix(infix->token.type, type1, value1, value2, infix->segment());
+    } else if (auto compare = dynamic_cast<const CompareExpr*>(expr)) {
+        auto type1 = compare->lhs->getType();
+        if (isPointer(type1) || isFunction(type1)) throw Unsupported{};
+        auto value1 = eval(compare->lhs.get());
+        auto value2 = eval(compare->rhs.get());
+        return compare->apply(value1, value2);
+    } else if (auto logical = dynamic_cast<const LogicalExpr*>(expr)) {
+        bool conjunction = logical->token.type == TokenType::OP_LAND;
+        auto value1 = eval(logical->lhs.get());
+        if (conjunction == value1.$bool) return eval(logical->rhs.get());
+        return value1;
+    } else if (auto invoke = dynamic_cast<const InfixInvokeExpr*>(expr)) {
+        auto value1 = eval(invoke->lhs.get());
+        auto value2 = eval(invoke->rhs.get());
+        return call(invoke->infix.get(), {value1, value2});
+    } else if (auto invoke = dynamic_cast<const InvokeExpr*>(expr)) {
+        std::vector<$union> args;
+        for (auto&& e : invoke->rhs) {
+            args.push_back(eval(e.get()));
+        }
+        return call(invoke->lhs.get(), args);
+    } else if (auto assign = dynamic_cast<const AssignExpr*>(expr)) {
+        auto id = dynamic_cast<const IdExpr*>(assign->lhs.get());
+        if (!id) throw Unsupported{};
+        auto value = eval(assign->rhs.get());
+        if (id->lookup.scope == LocalContext::LookupResult::Scope::NONE) return value;
+        auto& target = local(id);
+        if (assign->token.type != TokenType::OP_ASSIGN) {
+            value = Porkchop::infix(compoundOf(assign->token.type), type, target, value, assign->segment());
+        }
+        return target = value;
+    } else if (auto as = dynamic_cast<const AsExpr*>(expr)) {
+        if (isPointer(as->lhs->getType())) throw Unsupported{};
+        return as->apply(eval(as->lhs.get()));
+    } else if (auto clause = dynamic_cast<const ClauseExpr*>(expr)) {
+        $union value = nullptr;
+        for (auto&& line : clause->lines) {
+            value = eval(line.get());
+        }
+        return value;
+    } else if (auto ifElse = dynamic_cast<const IfElseExpr*>(expr)) {
+        return eval(eval(ifElse->cond.get()).$bool ? ifElse->lhs.get() : ifElse->rhs.get());
+    } else if (auto match = dynamic_cast<const MatchExpr*>(expr)) {
+        auto arm = match->select(eval(match->cond.get()));
+        if (!arm) throw Unsupported{};
+        return eval(arm);
+    } else if (auto loop = dynamic_cast<const WhileExpr*>(expr)) {
+        try {
+            while (eval(loop->cond.get()).$bool) {
+                eval(loop->clause.get());
+            }
+        } catch (Break& b) {
+            if (b.loop != loop) throw;
+        }
+        return nullptr;
+    } else if (auto b = dynamic_cast<const BreakExpr*>(expr)) {
+        throw Break{b->hook->loop};
+    } else if (auto ret = dynamic_cast<const ReturnExpr*>(expr)) {
+        throw Return{eval(ret->rhs.get())};
+    } else if (auto let = dynamic_cast<const LetExpr*>(expr)) {
+        auto value = eval(let->initializer.get());
+        if (let->declarator->name->lookup.scope != LocalContext::LookupResult::Scope::NONE) {
+            local(let->declarator->name.get()) = value;
+        }
+        return value;
+    } else if (auto builtin = dynamic_cast<const BuiltinExpr*>(expr)) {
+        switch (builtin->builtin) {
+            case Builtin::LIKELY:
+            case Builtin::UNLIKELY:
+                return eval(builtin->rhs[0].get());
+            case Builtin::ASSUME:
+                if (!eval(builtin->rhs[0].get()).$bool) throw Unsupported{};
+                return nullptr;
+            case Builtin::WRAPPING_ADD:
+            case Builtin::WRAPPING_SUB:
+            case Builtin::WRAPPING_MUL:
+            case Builtin::WRAPPING_SHL: {
+                auto value1 = eval(builtin->rhs[0].get());
+                auto value2 = eval(builtin->rhs[1].get());
+                return InfixExpr::apply(builtin->wrappingOperator(), type, value1, value2, builtin->segment());
+            }
+            default:
+                throw Unsupported{};
+        }
+    }
+    throw Unsupported{};
+}
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "tree.hpp"
+
+namespace Porkchop {
+
+// evaluates invocations of global functions at compile-time by walking their trees.
+// only functions that touch nothing but their own locals and parameters can be evaluated.
+struct Interpreter {
+    static constexpr size_t MAX_STEPS = 1000000;
+    static constexpr size_t MAX_DEPTH = 256;
+
+    GlobalScope* global;
+    size_t steps = 0, depth = 0;
+
+    explicit Interpreter(GlobalScope* global): global(global) {}
+
+    std::optional<$union> invoke(const Expr* callee, std::vector<$union> const& args);
+
+    // calls made while another evaluation runs share its depth and step budget
+    static std::optional<$union> evaluate(GlobalScope* global, const Expr* callee, std::vector<$union> const& args);
+
+private:
+    struct Frame {
+        std::vector<$union> locals;
+        size_t offset;
+    };
+    Frame* frame = nullptr;
+
+    $union call(const Expr* callee, std::vector<$union> const& args);
+    $union eval(const Expr* expr);
+    $union& local(const IdExpr* id);
+    $union element(const Expr* array, int64_t index);
+};
+
+}
@@ -25,9 +25,9 @@ namespace Porkchop {
 }
 
 // not a punctuation: _ #
-// unused: ` ? @ $
+// unused: ` ? $
 [[nodiscard]] constexpr bool isPunctuation(char ch) {
-    return ch == '!' || ch == '"' || '$' < ch && ch <= '/' || ':' <= ch && ch <= '>' || '[' <= ch && ch <= '^' || '{' <= ch && ch <= '~';
+    return ch == '!' || ch == '"' || '$' < ch && ch <= '/' || ':' <= ch && ch <= '>' || ch == '@' || '[' <= ch && ch <= '^' || '{' <= ch && ch <= '~';
 }
 
 [[nodiscard]] bool isIdentifierStart(char32_t ch) {
@@ -1,47 +1,775 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+#include <stdatomic.h>
 #include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 
 typedef void pc_none;
 #define pc_never _Noreturn void
 typedef _Bool pc_bool;
 typedef long pc_int;
 typedef double pc_float;
+typedef int8_t pc_i8;
+typedef int16_t pc_i16;
+typedef int32_t pc_i32;
+typedef uint8_t pc_u8;
+typedef uint16_t pc_u16;
+typedef uint32_t pc_u32;
+typedef uint64_t pc_u64;
+typedef float pc_f32;
+
+/*
+ * alloc and dealloc forward to malloc, unless the runtime is compiled with
+ * -DPORKCHOP_POOL_ALLOC or run with PORKCHOP_ALLOC=pool. In that case small blocks
+ * are served from per-thread free lists, one per size class, which exchange batches
+ * of blocks with a central depot under a lock only when they run empty or grow too
+ * long. Every block carries a header with its size class, larger ones go to malloc.
+ * Setting PORKCHOP_ALLOC_STATS prints the statistics of the allocator at exit.
+ */
+
+#define HEAP_CLASSES 13
+#define HEAP_LARGE HEAP_CLASSES
+#define HEAP_BATCH 32
+#define HEAP_SLAB (64 * 1024)
+
+static const pc_int heap_class_sizes[HEAP_CLASSES] = {16, 32, 48, 64, 80, 96, 112, 128, 256, 512, 1024, 2048, 4096};
+
+typedef struct heap_block {
+    pc_int size_class;
+    pc_int reserved; // keeps the payload 16-byte aligned
+    struct heap_block* next; // overlaps the payload while the block is free
+} heap_block;
+
+#define HEAP_HEADER offsetof(heap_block, next)
+
+typedef struct {
+    _Atomic pc_int allocations;
+    _Atomic pc_int deallocations;
+    _Atomic pc_int large;
+    _Atomic pc_int refills;
+    _Atomic pc_int flushes;
+} heap_stats;
+
+typedef struct heap_cache {
+    heap_block* blocks[HEAP_CLASSES];
+    pc_int counts[HEAP_CLASSES];
+    heap_stats stats;
+    struct heap_cache* next;
+} heap_cache;
+
+static struct {
+    pthread_once_t once;
+    pc_bool enabled;
+    pthread_key_t key;
+    pthread_mutex_t lock; // guards everything below
+    heap_block* blocks[HEAP_CLASSES];
+    pc_int counts[HEAP_CLASSES];
+    heap_cache* caches; // of the live threads
+    heap_stats retired; // of the exited threads
+    pc_int slabs;
+} heap = {PTHREAD_ONCE_INIT, 0, 0, PTHREAD_MUTEX_INITIALIZER};
+
+static _Thread_local heap_cache* heap_local;
+
+// only the owner thread writes its counters, the report may read them at any time
+static void heap_count(_Atomic pc_int* counter, pc_int delta) {
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + delta, memory_order_relaxed);
+}
+
+static void heap_flush(heap_cache* cache, pc_int index, pc_int count) {
+    heap_block* first = cache->blocks[index];
+    heap_block* last = first;
+    for (pc_int i = 1; i < count; ++i) last = last->next;
+    cache->blocks[index] = last->next;
+    cache->counts[index] -= count;
+    pthread_mutex_lock(&heap.lock);
+    last->next = heap.blocks[index];
+    heap.blocks[index] = first;
+    heap.counts[index] += count;
+    pthread_mutex_unlock(&heap.lock);
+    heap_count(&cache->stats.flushes, 1);
+}
+
+static void heap_stats_add(heap_stats* total, heap_stats* stats) {
+    heap_count(&total->allocations, atomic_load_explicit(&stats->allocations, memory_order_relaxed));
+    heap_count(&total->deallocations, atomic_load_explicit(&stats->deallocations, memory_order_relaxed));
+    heap_count(&total->large, atomic_load_explicit(&stats->large, memory_order_relaxed));
+    heap_count(&total->refills, atomic_load_explicit(&stats->refills, memory_order_relaxed));
+    heap_count(&total->flushes, atomic_load_explicit(&stats->flushes, memory_order_relaxed));
+}
+
+static void heap_cache_destroy(pc_none* cache_) {
+    heap_cache* cache = cache_;
+    for (pc_int i = 0; i < HEAP_CLASSES; ++i) {
+        if (cache->counts[i] > 0) heap_flush(cache, i, cache->counts[i]);
+    }
+    pthread_mutex_lock(&heap.lock);
+    heap_cache** link = &heap.caches;
+    while (*link != cache) link = &(*link)->next;
+    *link = cache->next;
+    heap_stats_add(&heap.retired, &cache->stats);
+    pthread_mutex_unlock(&heap.lock);
+    free(cache);
+}
+
+pc_none alloc_stats() {
+    if (!heap.enabled) {
+        fprintf(stderr, "alloc: forwarding to malloc\n");
+        return;
+    }
+    heap_stats total = {0};
+    pthread_mutex_lock(&heap.lock);
+    heap_stats_add(&total, &heap.retired);
+    for (heap_cache* cache = heap.caches; cache; cache = cache->next) {
+        heap_stats_add(&total, &cache->stats);
+    }
+    pc_int slabs = heap.slabs;
+    pthread_mutex_unlock(&heap.lock);
+    fprintf(stderr, "alloc: %ld allocations, %ld deallocations, %ld large, %ld refills, %ld flushes, %ld slabs\n",
+        total.allocations, total.deallocations, total.large, total.refills, total.flushes, slabs);
+}
+
+static void heap_init(void) {
+    const char* mode = getenv("PORKCHOP_ALLOC");
+#ifdef PORKCHOP_POOL_ALLOC
+    heap.enabled = mode == NULL || strcmp(mode, "malloc") != 0;
+#else
+    heap.enabled = mode != NULL && strcmp(mode, "pool") == 0;
+#endif
+    if (!heap.enabled) return;
+    pthread_key_create(&heap.key, heap_cache_destroy);
+    if (getenv("PORKCHOP_ALLOC_STATS")) atexit(alloc_stats);
+}
+
+static heap_cache* heap_cache_get(void) {
+    heap_cache* cache = heap_local;
+    if (cache) return cache;
+    cache = calloc(1, sizeof(heap_cache));
+    pthread_setspecific(heap.key, cache);
+    pthread_mutex_lock(&heap.lock);
+    cache->next = heap.caches;
+    heap.caches = cache;
+    pthread_mutex_unlock(&heap.lock);
+    return heap_local = cache;
+}
+
+static pc_int heap_class(pc_int size) {
+    if (size <= 128) return size > 0 ? (size - 1) / 16 : 0;
+    for (pc_int index = 8; index < HEAP_CLASSES; ++index) {
+        if (size <= heap_class_sizes[index]) return index;
+    }
+    return HEAP_LARGE;
+}
+
+// slow path, the free list is empty: take a batch from the depot, carving a new slab if needed
+static void heap_refill(heap_cache* cache, pc_int index) {
+    pc_int stride = HEAP_HEADER + heap_class_sizes[index];
+    pthread_mutex_lock(&heap.lock);
+    if (heap.counts[index] < HEAP_BATCH) {
+        pc_int count = HEAP_SLAB / stride > HEAP_BATCH ? HEAP_SLAB / stride : HEAP_BATCH;
+        pc_u8* slab = malloc(stride * count);
+        for (pc_int i = 0; i < count; ++i) {
+            heap_block* block = (heap_block*) (slab + i * stride);
+            block->next = heap.blocks[index];
+            heap.blocks[index] = block;
+        }
+        heap.counts[index] += count;
+        ++heap.slabs;
+    }
+    heap_block* first = heap.blocks[index];
+    heap_block* last = first;
+    for (pc_int i = 1; i < HEAP_BATCH; ++i) last = last->next;
+    heap.blocks[index] = last->next;
+    heap.counts[index] -= HEAP_BATCH;
+    pthread_mutex_unlock(&heap.lock);
+    last->next = cache->blocks[index];
+    cache->blocks[index] = first;
+    cache->counts[index] += HEAP_BATCH;
+    heap_count(&cache->stats.refills, 1);
+}
 
 pc_none* alloc(pc_int size) {
-    return malloc(size);
+    pthread_once(&heap.once, heap_init);
+    if (!heap.enabled) return malloc(size);
+    heap_cache* cache = heap_cache_get();
+    heap_count(&cache->stats.allocations, 1);
+    pc_int index = heap_class(size);
+    heap_block* block;
+    if (index == HEAP_LARGE) {
+        heap_count(&cache->stats.large, 1);
+        block = malloc(HEAP_HEADER + size);
+        if (block == NULL) return NULL;
+    } else {
+        if (cache->blocks[index] == NULL) heap_refill(cache, index);
+        block = cache->blocks[index];
+        cache->blocks[index] = block->next;
+        --cache->counts[index];
+    }
+    block->size_class = index;
+    return (pc_u8*) block + HEAP_HEADER;
 }
 
 pc_none dealloc(pc_none* array) {
+    if (!heap.enabled) {
+        free(array);
+        return;
+    }
+    if (array == NULL) return;
+    heap_cache* cache = heap_cache_get();
+    heap_count(&cache->stats.deallocations, 1);
+    heap_block* block = (heap_block*) ((pc_u8*) array - HEAP_HEADER);
+    pc_int index = block->size_class;
+    if (index == HEAP_LARGE) {
+        free(block);
+        return;
+    }
+    block->next = cache->blocks[index];
+    cache->blocks[index] = block;
+    // hand surplus back to the depot so that blocks freed by another thread do not pile up here
+    if (++cache->counts[index] > HEAP_BATCH * 2) heap_flush(cache, index, HEAP_BATCH);
+}
+
+/*
+ * Memory for large arrays. alloc_aligned rounds the alignment up to 16 bytes, since
+ * that is what malloc gives anyway. alloc_huge maps whole 2 MiB pages and asks for
+ * transparent huge pages, which cuts the page faults and TLB misses of streaming
+ * through the array, and quietly keeps 4 KiB pages where the kernel refuses. The
+ * length of the mapping is kept in a header right in front of the array.
+ */
+
+#define HUGE_PAGE (2 * 1024 * 1024)
+#define HUGE_HEADER 64
+
+pc_none* alloc_aligned(pc_int size, pc_int align) {
+    pc_none* result;
+    if (align < 16) align = 16;
+    return posix_memalign(&result, align, size) == 0 ? result : NULL;
+}
+
+pc_none dealloc_aligned(pc_none* array) {
     free(array);
 }
 
+pc_none* alloc_huge(pc_int size) {
+    pc_int length = (HUGE_HEADER + size + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+    // over-allocate by a page to cut an aligned mapping out of it
+    pc_u8* mapping = mmap(NULL, length + HUGE_PAGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) return NULL;
+    pc_u8* base = (pc_u8*) (((uintptr_t) mapping + HUGE_PAGE - 1) & -(uintptr_t) HUGE_PAGE);
+    if (base > mapping) munmap(mapping, base - mapping);
+    munmap(base + length, mapping + HUGE_PAGE - base);
+#ifdef MADV_HUGEPAGE
+    madvise(base, length, MADV_HUGEPAGE);
+#endif
+    *(pc_int*) base = length;
+    return base + HUGE_HEADER;
+}
+
+pc_none dealloc_huge(pc_none* array) {
+    if (array == NULL) return;
+    pc_u8* base = (pc_u8*) array - HUGE_HEADER;
+    munmap(base, *(pc_int*) base);
+}
+
+/*
+ * Output goes through a buffer that is handed to write in large batches, instead of
+ * through printf. Numbers are converted by hand: integers two digits at a time, and
+ * floats exactly as "%f" would print them, by splitting off the integral part and
+ * rounding the binary fraction to six digits with 128-bit arithmetic. The buffer is
+ * flushed by flush_output, at exit, and after every call if stdout is a terminal.
+ */
+
+#define OUTPUT_CAPACITY (64 * 1024)
+// enough for any number, the longest being "%f" of -DBL_MAX at 317 characters
+#define FORMAT_CAPACITY 512
+
+typedef struct {
+    int fd;
+    pc_int length;
+    char data[OUTPUT_CAPACITY];
+} output_buffer;
+
+static struct {
+    pthread_once_t once;
+    pthread_mutex_t lock;
+    pc_bool interactive;
+    output_buffer buffer;
+} output = {PTHREAD_ONCE_INIT, PTHREAD_MUTEX_INITIALIZER, 0, {1}};
+
+static const char digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static void output_drain(output_buffer* buffer) {
+    for (pc_int written = 0; written < buffer->length; ) {
+        ssize_t result = write(buffer->fd, buffer->data + written, buffer->length - written);
+        if (result < 0) break;
+        written += result;
+    }
+    buffer->length = 0;
+}
+
+// room for at least size more bytes
+static char* output_reserve(output_buffer* buffer, pc_int size) {
+    if (buffer->length + size > OUTPUT_CAPACITY) output_drain(buffer);
+    return buffer->data + buffer->length;
+}
+
+static char* format_uint(char* out, pc_u64 value) {
+    char digits[20];
+    char* begin = digits + sizeof(digits);
+    while (value >= 100) {
+        begin -= 2;
+        memcpy(begin, digit_pairs + value % 100 * 2, 2);
+        value /= 100;
+    }
+    if (value >= 10) {
+        begin -= 2;
+        memcpy(begin, digit_pairs + value * 2, 2);
+    } else {
+        *--begin = (char) ('0' + value);
+    }
+    pc_int length = digits + sizeof(digits) - begin;
+    memcpy(out, begin, length);
+    return out + length;
+}
+
+static char* format_int(char* out, pc_int value) {
+    if (value < 0) {
+        *out++ = '-';
+        return format_uint(out, -(pc_u64) value);
+    }
+    return format_uint(out, value);
+}
+
+static char* format_float(char* out, pc_float value) {
+    if (!isfinite(value) || value >= 0x1p63 || value <= -0x1p63) {
+        return out + snprintf(out, FORMAT_CAPACITY, "%f", value);
+    }
+    if (signbit(value)) {
+        *out++ = '-';
+        value = -value;
+    }
+    pc_u64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int exponent = bits >> 52;
+    pc_u64 mantissa = bits & ((1ul << 52) - 1);
+    if (exponent) mantissa |= 1ul << 52; else exponent = 1;
+    // value = mantissa * 2^-shift
+    int shift = 1075 - exponent;
+    pc_u64 integral = 0, micros = 0;
+    if (shift <= 0) {
+        integral = mantissa << -shift;
+    } else if (shift < 120) {
+        // anything smaller than 2^-67 rounds to zero anyway
+        integral = shift < 64 ? mantissa >> shift : 0;
+        unsigned __int128 one = (unsigned __int128) 1 << shift;
+        unsigned __int128 scaled = (mantissa & (one - 1)) * (unsigned __int128) 1000000;
+        unsigned __int128 remainder = scaled & (one - 1), half = one >> 1;
+        micros = scaled >> shift;
+        if (remainder > half || (remainder == half && micros % 2)) ++micros;
+        if (micros == 1000000) {
+            ++integral;
+            micros = 0;
+        }
+    }
+    out = format_uint(out, integral);
+    *out++ = '.';
+    for (int i = 5; i >= 0; --i) {
+        out[i] = (char) ('0' + micros % 10);
+        micros /= 10;
+    }
+    return out + 6;
+}
+
+pc_none flush_output() {
+    pthread_mutex_lock(&output.lock);
+    output_drain(&output.buffer);
+    pthread_mutex_unlock(&output.lock);
+}
+
+static void output_init(void) {
+    output.interactive = isatty(1);
+    atexit(flush_output);
+}
+
+static output_buffer* output_lock(void) {
+    pthread_once(&output.once, output_init);
+    pthread_mutex_lock(&output.lock);
+    return &output.buffer;
+}
+
+static void output_unlock(output_buffer* buffer) {
+    if (output.interactive) output_drain(buffer);
+    pthread_mutex_unlock(&output.lock);
+}
+
 pc_none printint(pc_int value) {
-    printf("%ld\n", value);
+    output_buffer* buffer = output_lock();
+    char* out = format_int(output_reserve(buffer, FORMAT_CAPACITY), value);
+    *out++ = '\n';
+    buffer->length = out - buffer->data;
+    output_unlock(buffer);
+}
+
+pc_none printuint(pc_u64 value) {
+    output_buffer* buffer = output_lock();
+    char* out = format_uint(output_reserve(buffer, FORMAT_CAPACITY), value);
+    *out++ = '\n';
+    buffer->length = out - buffer->data;
+    output_unlock(buffer);
 }
 
 pc_none printfloat(pc_float value) {
-    printf("%f\n", value);
+    output_buffer* buffer = output_lock();
+    char* out = format_float(output_reserve(buffer, FORMAT_CAPACITY), value);
+    *out++ = '\n';
+    buffer->length = out - buffer->data;
+    output_unlock(buffer);
 }
 
+// formats every element followed by sep, and ends the line
+#define OUTPUT_ARRAY(buffer, array, size, sep, format) \
+    for (pc_int i = 0; i < size; ++i) { \
+        char* out = format(output_reserve(buffer, FORMAT_CAPACITY), array[i]); \
+        *out++ = (char) sep; \
+        buffer->length = out - buffer->data; \
+    } \
+    buffer->data[buffer->length++] = '\n'; // the last reserve left room for it
+
 pc_none print_int_array(pc_int* array, pc_int size) {
-    for (int i = 0; i < size; ++i) {
-        printf("%ld ", array[i]);
+    output_buffer* buffer = output_lock();
+    output_reserve(buffer, 1);
+    OUTPUT_ARRAY(buffer, array, size, ' ', format_int)
+    output_unlock(buffer);
+}
+
+pc_none print_i32_array(pc_i32* array, pc_int size) {
+    output_buffer* buffer = output_lock();
+    output_reserve(buffer, 1);
+    OUTPUT_ARRAY(buffer, array, size, ' ', format_int)
+    output_unlock(buffer);
+}
+
+pc_none print_f32_array(pc_f32* array, pc_int size) {
+    output_buffer* buffer = output_lock();
+    output_reserve(buffer, 1);
+    OUTPUT_ARRAY(buffer, array, size, ' ', format_float)
+    output_unlock(buffer);
+}
+
+// stdout shares the buffer of the print functions, other files get a buffer of their own
+#define WRITE_ARRAY(fd, array, size, sep, format) \
+    if (fd == 1) { \
+        output_buffer* buffer = output_lock(); \
+        output_reserve(buffer, 1); \
+        OUTPUT_ARRAY(buffer, array, size, sep, format) \
+        output_unlock(buffer); \
+    } else { \
+        output_buffer* buffer = malloc(sizeof(output_buffer)); \
+        buffer->fd = fd; \
+        buffer->length = 0; \
+        OUTPUT_ARRAY(buffer, array, size, sep, format) \
+        output_drain(buffer); \
+        free(buffer); \
     }
-    printf("\n");
+
+pc_none write_int_array(pc_int fd, pc_int* array, pc_int size, pc_int sep) {
+    WRITE_ARRAY(fd, array, size, sep, format_int)
+}
+
+pc_none write_float_array(pc_int fd, pc_float* array, pc_int size, pc_int sep) {
+    WRITE_ARRAY(fd, array, size, sep, format_float)
 }
 
 pc_never exit(int);
 
-pc_int thread_create(pc_none *(*callback)(pc_none *), pc_none* arg) {
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+static void futex_wait(_Atomic uint32_t* word, uint32_t value) {
+    syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static void futex_wake(_Atomic uint32_t* word, int count) {
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+/*
+ * The number of worker threads is PORKCHOP_THREADS if set, or else the number of CPUs this
+ * process may run on, limited by the cgroup CPU quota of its container.
+ * Setting PORKCHOP_PIN pins each worker thread to one of these CPUs.
+ */
+
+static struct {
+    pthread_once_t once;
+    pc_int count;
+    pc_bool pin;
+    cpu_set_t cpus;
+} threads = {PTHREAD_ONCE_INIT};
+
+#define CGROUP_V2 "/sys/fs/cgroup"
+#define CGROUP_V1 "/sys/fs/cgroup/cpu"
+
+// the CPUs granted by the quota of one cgroup directory, 0 if it sets none
+static pc_int cgroup_limit(const char* dir, pc_bool v1) {
+    char name[PATH_MAX + 32];
+    long quota = -1, period = 0;
+    FILE* file;
+    snprintf(name, sizeof(name), v1 ? "%s/cpu.cfs_quota_us" : "%s/cpu.max", dir);
+    if ((file = fopen(name, "r"))) {
+        if (v1) {
+            if (fscanf(file, "%ld", &quota) != 1) quota = -1;
+        } else {
+            if (fscanf(file, "%ld %ld", &quota, &period) != 2) quota = -1; // "max 100000" means no quota
+        }
+        fclose(file);
+    }
+    snprintf(name, sizeof(name), "%s/cpu.cfs_period_us", dir);
+    if (v1 && (file = fopen(name, "r"))) {
+        if (fscanf(file, "%ld", &period) != 1) period = 0;
+        fclose(file);
+    }
+    if (quota <= 0 || period <= 0) return 0;
+    return (quota + period - 1) / period;
+}
+
+// finds the cgroup of this process in /proc/self/cgroup, preferring the v1 cpu controller over the v2 hierarchy
+static pc_bool cgroup_path(char* path, pc_bool* v1) {
+    char line[PATH_MAX + 64];
+    pc_bool found = 0;
+    FILE* file = fopen("/proc/self/cgroup", "r");
+    if (!file) return 0;
+    while (fgets(line, sizeof(line), file)) {
+        // "0::/path" for cgroup v2, "4:cpu,cpuacct:/path" for v1
+        char* controllers = strchr(line, ':');
+        char* relative = controllers ? strchr(controllers + 1, ':') : NULL;
+        if (!relative) continue;
+        *relative++ = '\0';
+        relative[strcspn(relative, "\n")] = '\0';
+        pc_bool cpu = 0;
+        for (char* controller = strtok(controllers + 1, ","); controller; controller = strtok(NULL, ",")) {
+            if (strcmp(controller, "cpu") == 0) cpu = 1;
+        }
+        if (cpu || (!found && controllers[1] == '\0')) {
+            snprintf(path, PATH_MAX, "%s", relative);
+            *v1 = cpu;
+            found = 1;
+            if (cpu) break;
+        }
+    }
+    fclose(file);
+    return found;
+}
+
+// the limit of a cgroup also bounds everything below it, so the tightest quota up to the root applies
+static pc_int cgroup_quota(void) {
+    char path[PATH_MAX], dir[PATH_MAX + sizeof(CGROUP_V1)];
+    pc_bool v1 = 0;
+    if (!cgroup_path(path, &v1)) {
+        pc_int quota = cgroup_limit(CGROUP_V2, 0);
+        return quota > 0 ? quota : cgroup_limit(CGROUP_V1, 1);
+    }
+    const char* root = v1 ? CGROUP_V1 : CGROUP_V2;
+    pc_int root_length = strlen(root), quota = 0;
+    snprintf(dir, sizeof(dir), "%s%s", root, path);
+    for (;;) {
+        // without a cgroup namespace, directories above the container's own are not mounted and have no limit files
+        pc_int limit = cgroup_limit(dir, v1);
+        if (limit > 0 && (quota == 0 || limit < quota)) quota = limit;
+        char* slash = strrchr(dir, '/');
+        if ((pc_int) strlen(dir) <= root_length || slash == NULL) break;
+        *(slash - dir < root_length ? dir + root_length : slash) = '\0';
+    }
+    return quota;
+}
+
+static void threads_init(void) {
+    pc_int count = 0;
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &threads.cpus) == 0) {
+        count = CPU_COUNT(&threads.cpus);
+    } else {
+        CPU_ZERO(&threads.cpus);
+        count = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    pc_int quota = cgroup_quota();
+    if (quota > 0 && quota < count) count = quota;
+    const char* env = getenv("PORKCHOP_THREADS");
+    if (env && atol(env) > 0) count = atol(env);
+    threads.count = count > 0 ? count : 1;
+    env = getenv("PORKCHOP_PIN");
+    threads.pin = env && *env && strcmp(env, "0") != 0 && CPU_COUNT(&threads.cpus) > 0;
+}
+
+pc_int thread_count() {
+    pthread_once(&threads.once, threads_init);
+    return threads.count;
+}
+
+static void thread_pin(pc_int index) {
+    pc_int n = index % CPU_COUNT(&threads.cpus);
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &threads.cpus) && n-- == 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+            return;
+        }
+    }
+}
+
+/*
+ * A process-wide pool of parked worker threads shared by all parallel primitives.
+ * Each job is handed over to an idle worker, or to a new one if all of them are busy,
+ * so that jobs waiting on each other never run out of threads.
+ */
+
+typedef struct {
+    pc_none *(*routine)(pc_none *);
+    pc_none* arg;
+    pc_none* result;
+    _Atomic uint32_t* latch; // counts down once the job finishes
+    _Atomic uint32_t pending;
+} pool_job;
+
+typedef struct pool_worker {
     pthread_t thread;
-    pthread_create(&thread, NULL, callback, arg);
-    return thread;
+    pc_int index;
+    _Atomic uint32_t ticket; // futex word, bumped whenever a job is handed over
+    pool_job* job;
+    struct pool_worker* next;
+} pool_worker;
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_once_t once;
+    pool_worker* idle;
+    pc_int spawned;
+    pc_bool shutdown;
+} pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_ONCE_INIT, NULL, 0, 0};
+
+static void pool_done(_Atomic uint32_t* latch) {
+    if (atomic_fetch_sub_explicit(latch, 1, memory_order_acq_rel) == 1) {
+        futex_wake(latch, INT32_MAX);
+    }
+}
+
+static void pool_await(_Atomic uint32_t* latch) {
+    uint32_t value;
+    // spin for a short while first, since small jobs finish sooner than a futex round trip
+    for (int i = 0; i < 4096; ++i) {
+        if (atomic_load_explicit(latch, memory_order_acquire) == 0) return;
+        cpu_relax();
+    }
+    while ((value = atomic_load_explicit(latch, memory_order_acquire)) != 0) {
+        futex_wait(latch, value);
+    }
+}
+
+static pc_none* pool_worker_routine(pc_none* worker_) {
+    pool_worker* worker = worker_;
+    if (threads.pin) thread_pin(worker->index);
+    while (worker->job) {
+        pool_job* job = worker->job;
+        _Atomic uint32_t* latch = job->latch;
+        job->result = job->routine(job->arg);
+        pthread_mutex_lock(&pool.lock);
+        if (pool.shutdown) {
+            pthread_mutex_unlock(&pool.lock);
+            pool_done(latch);
+            break;
+        }
+        worker->job = NULL;
+        uint32_t ticket = atomic_load_explicit(&worker->ticket, memory_order_relaxed);
+        worker->next = pool.idle;
+        pool.idle = worker;
+        pthread_mutex_unlock(&pool.lock);
+        // release the latch only once parked, so that a joined worker is always reachable by pool_shutdown
+        pool_done(latch);
+        while (atomic_load_explicit(&worker->ticket, memory_order_acquire) == ticket) {
+            futex_wait(&worker->ticket, ticket);
+        }
+    }
+    return NULL;
+}
+
+static void pool_shutdown(void) {
+    pthread_mutex_lock(&pool.lock);
+    pool.shutdown = 1;
+    pool_worker* idle = pool.idle;
+    pool.idle = NULL;
+    pthread_mutex_unlock(&pool.lock);
+    // busy workers see the flag after their current job and exit on their own
+    for (pool_worker* worker = idle; worker; worker = worker->next) {
+        atomic_fetch_add_explicit(&worker->ticket, 1, memory_order_release);
+        futex_wake(&worker->ticket, 1);
+    }
+    while (idle) {
+        pool_worker* next = idle->next;
+        pthread_join(idle->thread, NULL);
+        free(idle);
+        idle = next;
+    }
+}
+
+static void pool_init(void) {
+    thread_count();
+    atexit(pool_shutdown);
+}
+
+static void pool_submit(pool_job* job) {
+    pthread_once(&pool.once, pool_init);
+    pthread_mutex_lock(&pool.lock);
+    pool_worker* worker = pool.idle;
+    if (worker) {
+        pool.idle = worker->next;
+        worker->job = job;
+        pthread_mutex_unlock(&pool.lock);
+        atomic_fetch_add_explicit(&worker->ticket, 1, memory_order_release);
+        futex_wake(&worker->ticket, 1);
+        return;
+    }
+    pc_int index = pool.spawned++;
+    pthread_mutex_unlock(&pool.lock);
+    worker = malloc(sizeof(pool_worker));
+    worker->index = index;
+    atomic_init(&worker->ticket, 0);
+    worker->job = job;
+    pthread_create(&worker->thread, NULL, pool_worker_routine, worker);
+}
+
+pc_int thread_create(pc_none *(*callback)(pc_none *), pc_none* arg) {
+    pool_job* job = malloc(sizeof(pool_job));
+    job->routine = callback;
+    job->arg = arg;
+    atomic_init(&job->pending, 1);
+    job->latch = &job->pending;
+    pool_submit(job);
+    return (pc_int) job;
 }
 
 pc_none* thread_join(pc_int thread) {
-    pc_none* ret;
-    pthread_join(thread, &ret);
+    pool_job* job = (pool_job*) thread;
+    pool_await(job->latch);
+    pc_none* ret = job->result;
+    free(job);
     return ret;
 }
 
@@ -49,6 +777,348 @@ pc_int thread_self() {
     return pthread_self();
 }
 
+/*
+ * Tasks are much lighter than threads: task_spawn only queues a routine, which one of
+ * thread_count() task workers, themselves long-running jobs of the pool, picks up. The
+ * queue is a list guarded by a lock, and idle workers park on a futex until something
+ * is queued. A thread waiting for a task runs queued tasks in the meantime, so tasks
+ * may wait for other tasks without running out of workers. A continuation added by
+ * task_then is queued with the result of its task as argument once that one finishes.
+ */
+
+typedef struct task {
+    pc_none *(*routine)(pc_none *);
+    pc_none* arg;
+    pc_none* result;
+    _Atomic uint32_t state; // futex word, one of the TASK_* states
+    struct task* then; // the continuation, guarded by the queue lock
+    struct task* next; // in the queue
+} task;
+
+#define TASK_RUNNING 0
+#define TASK_WAITED 1 // still running, but someone sleeps on it
+#define TASK_DONE 2
+
+static struct {
+    pthread_once_t once;
+    pthread_mutex_t lock; // guards the queue and the continuations
+    task* head;
+    task* tail;
+    pc_int sleeping;
+    pc_int waking; // sleepers already signalled but not yet running
+    pc_bool shutdown;
+    _Atomic uint32_t signal; // futex word, bumped when work is queued for the sleepers
+    _Atomic uint32_t latch; // counts the live workers
+    pool_job* jobs; // kept until the process ends, a worker may still be running
+} tasks = {PTHREAD_ONCE_INIT, PTHREAD_MUTEX_INITIALIZER};
+
+// called with the lock held
+static void task_push(task* task) {
+    task->next = NULL;
+    if (tasks.tail) tasks.tail->next = task; else tasks.head = task;
+    tasks.tail = task;
+    // one syscall per sleeper, a worker that is already waking up drains the queue anyway
+    if (tasks.sleeping > tasks.waking) {
+        ++tasks.waking;
+        atomic_fetch_add_explicit(&tasks.signal, 1, memory_order_release);
+        futex_wake(&tasks.signal, 1);
+    }
+}
+
+// called with the lock held
+static task* task_pop(void) {
+    task* task = tasks.head;
+    if (task) {
+        tasks.head = task->next;
+        if (tasks.head == NULL) tasks.tail = NULL;
+    }
+    return task;
+}
+
+static void task_run(task* task) {
+    task->result = task->routine(task->arg);
+    uint32_t state = TASK_RUNNING;
+    pthread_mutex_lock(&tasks.lock);
+    struct task* then = task->then;
+    if (then) {
+        then->arg = task->result;
+        task_push(then);
+    } else {
+        // under the lock, so that task_then either finds the task done or attaches in time
+        state = atomic_exchange_explicit(&task->state, TASK_DONE, memory_order_acq_rel);
+    }
+    pthread_mutex_unlock(&tasks.lock);
+    if (then) {
+        // task_then took the handle away, nobody else refers to it
+        free(task);
+    } else if (state == TASK_WAITED) {
+        futex_wake(&task->state, INT32_MAX);
+    }
+}
+
+// runs one queued task, false if there was none
+static pc_bool task_help(void) {
+    pthread_mutex_lock(&tasks.lock);
+    task* task = task_pop();
+    pthread_mutex_unlock(&tasks.lock);
+    if (task == NULL) return 0;
+    task_run(task);
+    return 1;
+}
+
+static pc_none* task_worker_routine(pc_none* unused) {
+    pthread_mutex_lock(&tasks.lock);
+    while (!tasks.shutdown) {
+        task* task = task_pop();
+        if (task) {
+            pthread_mutex_unlock(&tasks.lock);
+            task_run(task);
+            pthread_mutex_lock(&tasks.lock);
+            continue;
+        }
+        uint32_t signal = atomic_load_explicit(&tasks.signal, memory_order_relaxed);
+        ++tasks.sleeping;
+        pthread_mutex_unlock(&tasks.lock);
+        futex_wait(&tasks.signal, signal);
+        pthread_mutex_lock(&tasks.lock);
+        --tasks.sleeping;
+        if (tasks.waking > 0) --tasks.waking;
+    }
+    pthread_mutex_unlock(&tasks.lock);
+    return NULL;
+}
+
+// queued tasks are dropped at exit and idle workers leave, while running tasks are not waited for,
+// since they may block forever or be the very caller of exit
+static void task_shutdown(void) {
+    pthread_mutex_lock(&tasks.lock);
+    tasks.shutdown = 1;
+    atomic_fetch_add_explicit(&tasks.signal, 1, memory_order_release);
+    pthread_mutex_unlock(&tasks.lock);
+    futex_wake(&tasks.signal, INT32_MAX);
+}
+
+static void task_init(void) {
+    pc_int workers = thread_count();
+    tasks.jobs = malloc(sizeof(pool_job) * workers);
+    atomic_init(&tasks.latch, workers);
+    for (pc_int i = 0; i < workers; ++i) {
+        tasks.jobs[i].routine = task_worker_routine;
+        tasks.jobs[i].arg = NULL;
+        tasks.jobs[i].latch = &tasks.latch;
+        pool_submit(tasks.jobs + i);
+    }
+    // registered after the pool, so that it runs first
+    atexit(task_shutdown);
+}
+
+pc_int task_spawn(pc_none *(*routine)(pc_none *), pc_none* arg) {
+    pthread_once(&tasks.once, task_init);
+    task* task = malloc(sizeof(struct task));
+    task->routine = routine;
+    task->arg = arg;
+    atomic_init(&task->state, TASK_RUNNING);
+    task->then = NULL;
+    pthread_mutex_lock(&tasks.lock);
+    task_push(task);
+    pthread_mutex_unlock(&tasks.lock);
+    return (pc_int) task;
+}
+
+pc_none* task_wait(pc_int handle) {
+    task* task = (struct task*) handle;
+    uint32_t state;
+    while ((state = atomic_load_explicit(&task->state, memory_order_acquire)) == TASK_RUNNING) {
+        if (task_help()) continue;
+        // nothing left to help with, the task is running elsewhere
+        if (atomic_compare_exchange_weak_explicit(&task->state, &state, TASK_WAITED,
+            memory_order_acquire, memory_order_acquire)) break;
+    }
+    while (atomic_load_explicit(&task->state, memory_order_acquire) == TASK_WAITED) {
+        futex_wait(&task->state, TASK_WAITED);
+    }
+    pc_none* result = task->result;
+    free(task);
+    return result;
+}
+
+// results may be the same array as handles
+pc_none task_wait_all(pc_int* handles, pc_none** results, pc_int count) {
+    for (pc_int i = 0; i < count; ++i) {
+        results[i] = task_wait(handles[i]);
+    }
+}
+
+// takes over the handle, which must not be waited for any more
+pc_int task_then(pc_int handle, pc_none *(*routine)(pc_none *)) {
+    task* task = (struct task*) handle;
+    struct task* then = malloc(sizeof(struct task));
+    then->routine = routine;
+    atomic_init(&then->state, TASK_RUNNING);
+    then->then = NULL;
+    pthread_mutex_lock(&tasks.lock);
+    pc_bool done = atomic_load_explicit(&task->state, memory_order_acquire) == TASK_DONE;
+    if (done) {
+        then->arg = task->result;
+        task_push(then);
+    } else {
+        task->then = then;
+    }
+    pthread_mutex_unlock(&tasks.lock);
+    if (done) free(task);
+    return (pc_int) then;
+}
+
+/*
+ * Channels are bounded multi-producer multi-consumer ring buffers of fixed-size elements.
+ * Every slot carries a sequence number telling which lap of the ring may use it next, so
+ * that a sender or receiver claims a slot with a single compare-and-swap on the head or
+ * the tail and never takes a lock. Only when the channel is full or empty does a thread
+ * park on a futex, after announcing itself so that the other side knows to wake it.
+ */
+
+typedef struct chan {
+    _Alignas(64) _Atomic pc_int head; // the next position to send to
+    _Alignas(64) _Atomic pc_int tail; // the next position to receive from
+    _Alignas(64) _Atomic uint32_t sent; // futex word, bumped for sleeping receivers
+    _Atomic uint32_t receivers; // sleeping on sent
+    _Alignas(64) _Atomic uint32_t received; // futex word, bumped for sleeping senders
+    _Atomic uint32_t senders; // sleeping on received
+    _Alignas(64) pc_int capacity;
+    pc_int elem_size;
+    _Atomic pc_bool closed;
+    _Atomic pc_int* sequences;
+    pc_u8* elems;
+} chan;
+
+pc_none* chan_create(pc_int capacity, pc_int elem_size) {
+    // with a single slot, a filled and an emptied slot would carry the same sequence number
+    if (capacity < 2) capacity = 2;
+    pc_int align = _Alignof(chan);
+    pc_int size = sizeof(chan) + capacity * (sizeof(_Atomic pc_int) + elem_size);
+    chan* chan = aligned_alloc(align, (size + align - 1) / align * align);
+    atomic_init(&chan->head, 0);
+    atomic_init(&chan->tail, 0);
+    atomic_init(&chan->sent, 0);
+    atomic_init(&chan->receivers, 0);
+    atomic_init(&chan->received, 0);
+    atomic_init(&chan->senders, 0);
+    chan->capacity = capacity;
+    chan->elem_size = elem_size;
+    atomic_init(&chan->closed, 0);
+    chan->sequences = (_Atomic pc_int*) (chan + 1);
+    chan->elems = (pc_u8*) (chan->sequences + capacity);
+    for (pc_int i = 0; i < capacity; ++i) {
+        atomic_init(chan->sequences + i, i);
+    }
+    return chan;
+}
+
+pc_none chan_destroy(pc_none* chan) {
+    free(chan);
+}
+
+static void chan_notify(_Atomic uint32_t* word, _Atomic uint32_t* sleepers) {
+    // pairs with the announcement in chan_sleep, one of the two sides sees the other
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(sleepers, memory_order_relaxed) > 0) {
+        atomic_fetch_add_explicit(word, 1, memory_order_release);
+        futex_wake(word, 1);
+    }
+}
+
+static pc_bool chan_put(chan* chan, pc_none* elem) {
+    pc_int position = atomic_load_explicit(&chan->head, memory_order_relaxed);
+    for (;;) {
+        pc_int index = position % chan->capacity;
+        pc_int sequence = atomic_load_explicit(chan->sequences + index, memory_order_acquire);
+        if (sequence < position) return 0; // the slot still holds the element of the last lap
+        // sequentially consistent so that a receiver seeing the close also sees the slots claimed before it
+        if (sequence == position && atomic_compare_exchange_weak_explicit(&chan->head, &position, position + 1,
+            memory_order_seq_cst, memory_order_relaxed)) {
+            memcpy(chan->elems + index * chan->elem_size, elem, chan->elem_size);
+            atomic_store_explicit(chan->sequences + index, position + 1, memory_order_release);
+            chan_notify(&chan->sent, &chan->receivers);
+            return 1;
+        }
+        if (sequence > position) position = atomic_load_explicit(&chan->head, memory_order_relaxed);
+    }
+}
+
+static pc_bool chan_take(chan* chan, pc_none* elem) {
+    pc_int position = atomic_load_explicit(&chan->tail, memory_order_relaxed);
+    for (;;) {
+        pc_int index = position % chan->capacity;
+        pc_int sequence = atomic_load_explicit(chan->sequences + index, memory_order_acquire);
+        if (sequence < position + 1) return 0; // the slot has not been filled in this lap yet
+        if (sequence == position + 1 && atomic_compare_exchange_weak_explicit(&chan->tail, &position, position + 1,
+            memory_order_relaxed, memory_order_relaxed)) {
+            memcpy(elem, chan->elems + index * chan->elem_size, chan->elem_size);
+            atomic_store_explicit(chan->sequences + index, position + chan->capacity, memory_order_release);
+            chan_notify(&chan->received, &chan->senders);
+            return 1;
+        }
+        if (sequence > position + 1) position = atomic_load_explicit(&chan->tail, memory_order_relaxed);
+    }
+}
+
+// whether a put or take at the current head or tail would find its slot ready, or the channel closed
+static pc_bool chan_ready(chan* chan, _Atomic pc_int* end, pc_int lag) {
+    pc_int position = atomic_load_explicit(end, memory_order_relaxed);
+    pc_int sequence = atomic_load_explicit(chan->sequences + position % chan->capacity, memory_order_acquire);
+    return sequence >= position + lag || atomic_load_explicit(&chan->closed, memory_order_acquire);
+}
+
+static void chan_sleep(chan* chan, _Atomic uint32_t* word, _Atomic uint32_t* sleepers, _Atomic pc_int* end, pc_int lag) {
+    uint32_t seen = atomic_load_explicit(word, memory_order_acquire);
+    atomic_fetch_add_explicit(sleepers, 1, memory_order_seq_cst);
+    if (!chan_ready(chan, end, lag)) futex_wait(word, seen);
+    atomic_fetch_sub_explicit(sleepers, 1, memory_order_relaxed);
+}
+
+// blocks while the channel is full, false if it is closed
+pc_bool chan_send(pc_none* chan_, pc_none* elem) {
+    chan* chan = chan_;
+    for (;;) {
+        if (atomic_load_explicit(&chan->closed, memory_order_seq_cst)) return 0;
+        if (chan_put(chan, elem)) return 1;
+        chan_sleep(chan, &chan->received, &chan->senders, &chan->head, 0);
+    }
+}
+
+// false if the channel is full or closed
+pc_bool chan_try_send(pc_none* chan_, pc_none* elem) {
+    chan* chan = chan_;
+    if (atomic_load_explicit(&chan->closed, memory_order_seq_cst)) return 0;
+    return chan_put(chan, elem);
+}
+
+// blocks while the channel is empty, false once it is closed and drained
+pc_bool chan_recv(pc_none* chan_, pc_none* elem) {
+    chan* chan = chan_;
+    for (;;) {
+        if (chan_take(chan, elem)) return 1;
+        if (atomic_load_explicit(&chan->closed, memory_order_seq_cst)) {
+            pc_int tail = atomic_load_explicit(&chan->tail, memory_order_relaxed);
+            if (tail == atomic_load_explicit(&chan->head, memory_order_seq_cst)) return 0;
+            // a sender claimed a slot before the close and is still filling it in, no wakeup will come
+            sched_yield();
+            continue;
+        }
+        chan_sleep(chan, &chan->sent, &chan->receivers, &chan->tail, 1);
+    }
+}
+
+// wakes every sleeper, later sends fail and receives fail once the remaining elements are taken
+pc_none chan_close(pc_none* chan_) {
+    chan* chan = chan_;
+    atomic_store_explicit(&chan->closed, 1, memory_order_seq_cst);
+    atomic_fetch_add_explicit(&chan->sent, 1, memory_order_release);
+    atomic_fetch_add_explicit(&chan->received, 1, memory_order_release);
+    futex_wake(&chan->sent, INT32_MAX);
+    futex_wake(&chan->received, INT32_MAX);
+}
+
 pc_float pc_time() {
     struct timespec ts;
     timespec_get(&ts, TIME_UTC);
@@ -77,10 +1147,10 @@ static pc_none* parallel_reduce_routine(pc_none* task_) {
 pc_none* parallel_reduce(pc_none* data, pc_int size, pc_int length,
     pc_none *(*proj)(pc_none *), pc_none *(*acc)(pc_none *, pc_none *)) {
     if (length == 0) return NULL;
-    const pc_int CPU_COUNT = 16;
-    pc_int task_count = length < CPU_COUNT ? length : CPU_COUNT;
-    pthread_t* threads = malloc(sizeof(pc_int) * task_count);
+    pc_int task_count = length < thread_count() ? length : thread_count();
+    pool_job* jobs = malloc(sizeof(pool_job) * task_count);
     parallel_reduce_task* tasks = malloc(sizeof(parallel_reduce_task) * task_count);
+    _Atomic uint32_t latch = task_count - 1;
     for (pc_int i = 0; i < task_count; ++i) {
         tasks[i].data = data;
         tasks[i].size = size;
@@ -88,55 +1158,1000 @@ pc_none* parallel_reduce(pc_none* data, pc_int size, pc_int length,
         tasks[i].length = (i + 1) * length / task_count - i * length / task_count;
         tasks[i].proj = proj;
         tasks[i].acc = acc;
-        pthread_create(threads + i, NULL, parallel_reduce_routine, tasks + i);
+        jobs[i].routine = parallel_reduce_routine;
+        jobs[i].arg = tasks + i;
+        jobs[i].latch = &latch;
+        if (i > 0) pool_submit(jobs + i);
     }
-    pc_none* initial;
-    pthread_join(threads[0], &initial);
+    // the calling thread takes the first task instead of idling
+    pc_none* initial = parallel_reduce_routine(tasks);
+    pool_await(&latch);
     for (pc_int i = 1; i < task_count; ++i) {
-        pc_none* result;
-        pthread_join(threads[i], &result);
-        initial = acc(initial, result);
+        initial = acc(initial, jobs[i].result);
     }
     free(tasks);
-    free(threads);
+    free(jobs);
     return initial;
 }
 
+/*
+ * parallel_for cuts [0, length) into chunks of at most grain elements and balances them
+ * by work stealing. Every participant owns a Chase-Lev deque of chunk ranges: it keeps
+ * halving the range at hand, pushing the upper half for others to steal, and steals
+ * from the other deques once its own runs dry, so that a few expensive chunks no longer
+ * hold up the whole call.
+ */
+
+// a deque only ever holds one pending half per level of halving
+#define DEQUE_CAPACITY 64
 
+typedef struct {
+    _Atomic pc_int first;
+    _Atomic pc_int last;
+} deque_range;
 
 typedef struct {
+    _Alignas(64) _Atomic pc_int top;
+    _Atomic pc_int bottom;
+    deque_range ranges[DEQUE_CAPACITY];
+    struct parallel_for_task* task;
+} deque;
+
+static void deque_push(deque* deque, pc_int first, pc_int last) {
+    pc_int bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    deque_range* range = deque->ranges + bottom % DEQUE_CAPACITY;
+    atomic_store_explicit(&range->first, first, memory_order_relaxed);
+    atomic_store_explicit(&range->last, last, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+}
+
+// called by the owner only, takes the most recently pushed range
+static pc_bool deque_take(deque* deque, pc_int* first, pc_int* last) {
+    pc_int bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    pc_int top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return 0;
+    }
+    deque_range* range = deque->ranges + bottom % DEQUE_CAPACITY;
+    *first = atomic_load_explicit(&range->first, memory_order_relaxed);
+    *last = atomic_load_explicit(&range->last, memory_order_relaxed);
+    if (top < bottom) return 1;
+    // the last range left, race the thieves for it
+    pc_bool taken = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+        memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return taken;
+}
+
+// called by the other participants, takes the oldest and thus largest range
+static pc_bool deque_steal(deque* deque, pc_int* first, pc_int* last) {
+    pc_int top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    pc_int bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) return 0;
+    deque_range* range = deque->ranges + top % DEQUE_CAPACITY;
+    *first = atomic_load_explicit(&range->first, memory_order_relaxed);
+    *last = atomic_load_explicit(&range->last, memory_order_relaxed);
+    return atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+        memory_order_seq_cst, memory_order_relaxed);
+}
+
+typedef struct parallel_for_task {
     pc_none* data;
-    pc_int offset;
     pc_int length;
+    pc_int grain;
     pc_none *(*thread)(pc_none *data, pc_int offset, pc_int length);
+    pc_none** results;
+    deque* deques;
+    pc_int participants;
+    _Atomic pc_int remaining; // chunks not finished yet
 } parallel_for_task;
 
-static pc_none* parallel_for_routine(pc_none* task_) {
-    parallel_for_task* task = task_;
-    return task->thread(task->data, task->offset, task->length);
+static void parallel_for_chunk(parallel_for_task* task, pc_int chunk) {
+    pc_int offset = chunk * task->grain;
+    pc_int length = task->length - offset < task->grain ? task->length - offset : task->grain;
+    task->results[chunk] = task->thread(task->data, offset, length);
 }
 
-pc_none** parallel_for(pc_none* data, pc_int length, pc_none *(*thread)(pc_none *, pc_int, pc_int)) {
-    if (length == 0) return NULL;
-    const pc_int CPU_COUNT = 16;
-    pc_int task_count = length < CPU_COUNT ? length : CPU_COUNT;
-    pthread_t* threads = malloc(sizeof(pc_int) * task_count);
-    parallel_for_task* tasks = malloc(sizeof(parallel_reduce_task) * task_count);
-    pc_none** results = malloc(sizeof(pc_none*) * (task_count + 1));
-    *results++ = (pc_none*) task_count;
-    for (pc_int i = 0; i < task_count; ++i) {
-        tasks[i].data = data;
-        tasks[i].offset = i * length / task_count;
-        tasks[i].length = (i + 1) * length / task_count - i * length / task_count;
-        tasks[i].thread = thread;
-        pthread_create(threads + i, NULL, parallel_for_routine, tasks + i);
+static pc_none* parallel_for_routine(pc_none* deque_) {
+    deque* self = deque_;
+    parallel_for_task* task = self->task;
+    pc_int index = self - task->deques;
+    pc_int first, last, failures = 0;
+    while (atomic_load_explicit(&task->remaining, memory_order_relaxed) > 0) {
+        pc_bool found = deque_take(self, &first, &last);
+        for (pc_int i = 1; !found && i < task->participants; ++i) {
+            found = deque_steal(task->deques + (index + i) % task->participants, &first, &last);
+        }
+        if (!found) {
+            // give the CPU away now and then in case the participants outnumber the cores
+            if (++failures % 64 == 0) sched_yield(); else cpu_relax();
+            continue;
+        }
+        failures = 0;
+        while (last - first > 1) {
+            pc_int middle = first + (last - first) / 2;
+            deque_push(self, middle, last);
+            last = middle;
+        }
+        parallel_for_chunk(task, first);
+        atomic_fetch_sub_explicit(&task->remaining, 1, memory_order_relaxed);
     }
-    for (pc_int i = 0; i < task_count; ++i) {
-        pc_none* result;
-        pthread_join(threads[i], &result);
-        results[i] = result;
+    return NULL;
+}
+
+static pc_int parallel_grain(pc_int length) {
+    // a few chunks per thread leave enough slack to balance, while a single thread needs none
+    pc_int threads = thread_count();
+    if (threads == 1) return length;
+    pc_int grain = length / (threads * 8);
+    return grain > 0 ? grain : 1;
+}
+
+pc_none** parallel_for_grain(pc_none* data, pc_int length, pc_int grain,
+    pc_none *(*thread)(pc_none *, pc_int, pc_int)) {
+    if (length <= 0) return NULL;
+    if (grain <= 0) grain = parallel_grain(length);
+    pc_int chunks = length / grain + (length % grain != 0);
+    pc_none** results = alloc(sizeof(pc_none*) * (chunks + 1));
+    *results++ = (pc_none*) chunks;
+    parallel_for_task task = {data, length, grain, thread, results};
+    pc_int participants = chunks < thread_count() ? chunks : thread_count();
+    if (participants == 1) {
+        for (pc_int i = 0; i < chunks; ++i) {
+            parallel_for_chunk(&task, i);
+        }
+        return results;
     }
-    free(tasks);
-    free(threads);
+    deque* deques = aligned_alloc(_Alignof(deque), sizeof(deque) * participants);
+    pool_job* jobs = malloc(sizeof(pool_job) * participants);
+    task.deques = deques;
+    task.participants = participants;
+    atomic_init(&task.remaining, chunks);
+    _Atomic uint32_t latch = participants - 1;
+    for (pc_int i = 0; i < participants; ++i) {
+        atomic_init(&deques[i].top, 0);
+        atomic_init(&deques[i].bottom, 0);
+        deques[i].task = &task;
+    }
+    // everything starts in the caller's deque, the others steal their share from it
+    deque_push(deques, 0, chunks);
+    for (pc_int i = 1; i < participants; ++i) {
+        jobs[i].routine = parallel_for_routine;
+        jobs[i].arg = deques + i;
+        jobs[i].latch = &latch;
+        pool_submit(jobs + i);
+    }
+    parallel_for_routine(deques);
+    pool_await(&latch);
+    free(jobs);
+    free(deques);
     return results;
-}
\ No newline at end of file
+}
+
+pc_none** parallel_for(pc_none* data, pc_int length, pc_none *(*thread)(pc_none *, pc_int, pc_int)) {
+    return parallel_for_grain(data, length, 0, thread);
+}
+
+/*
+ * Typed reductions over plain arrays. Each chunk is folded by a loop over vectors of
+ * REDUCE_LANES elements that the C compiler maps to SIMD registers, and the partial
+ * results of the chunks are combined by the caller, so no element goes through an
+ * indirect call or a boxed *none. Floating-point sums are added in a different order
+ * from a sequential loop and may differ from it in the last bits.
+ */
+
+#define REDUCE_LANES 4
+// below this many elements per chunk, waking up workers costs more than it saves
+#define REDUCE_GRAIN 16384
+
+typedef pc_int reduce_int_vector __attribute__((vector_size(REDUCE_LANES * sizeof(pc_int))));
+typedef pc_u64 reduce_uint_vector __attribute__((vector_size(REDUCE_LANES * sizeof(pc_u64))));
+typedef pc_float reduce_float_vector __attribute__((vector_size(REDUCE_LANES * sizeof(pc_float))));
+
+enum { REDUCE_SUM, REDUCE_MIN, REDUCE_MAX, REDUCE_AND, REDUCE_OR, REDUCE_XOR };
+
+typedef union {
+    pc_int i;
+    pc_float f;
+    pc_none* boxed;
+} reduce_value;
+
+typedef struct {
+    pc_none* data;
+    pc_int op;
+} reduce_task;
+
+static pc_int reduce_int_identity(pc_int op) {
+    switch (op) {
+        case REDUCE_MIN: return INT64_MAX;
+        case REDUCE_MAX: return INT64_MIN;
+        case REDUCE_AND: return -1;
+        default: return 0;
+    }
+}
+
+static pc_int reduce_int_scalar(pc_int op, pc_int lhs, pc_int rhs) {
+    switch (op) {
+        case REDUCE_SUM: return (pc_int) ((pc_u64) lhs + (pc_u64) rhs);
+        case REDUCE_MIN: return lhs < rhs ? lhs : rhs;
+        case REDUCE_MAX: return lhs > rhs ? lhs : rhs;
+        case REDUCE_AND: return lhs & rhs;
+        case REDUCE_OR: return lhs | rhs;
+        default: return lhs ^ rhs;
+    }
+}
+
+// the switch stays outside of the loops so that every loop is a plain vector loop
+#define REDUCE_LOOP(vector, combine) \
+    for (; i + REDUCE_LANES <= length; i += REDUCE_LANES) { \
+        vector value; \
+        memcpy(&value, data + i, sizeof(vector)); \
+        combine; \
+    }
+
+static pc_int reduce_int_chunk(const pc_int* data, pc_int length, pc_int op) {
+    reduce_int_vector acc = (reduce_int_vector) {0} + reduce_int_identity(op);
+    pc_int i = 0;
+    switch (op) {
+        case REDUCE_SUM: REDUCE_LOOP(reduce_uint_vector, acc = (reduce_int_vector) ((reduce_uint_vector) acc + value)) break;
+        case REDUCE_MIN: REDUCE_LOOP(reduce_int_vector, reduce_int_vector less = acc < value; acc = (acc & less) | (value & ~less)) break;
+        case REDUCE_MAX: REDUCE_LOOP(reduce_int_vector, reduce_int_vector more = acc > value; acc = (acc & more) | (value & ~more)) break;
+        case REDUCE_AND: REDUCE_LOOP(reduce_int_vector, acc &= value) break;
+        case REDUCE_OR: REDUCE_LOOP(reduce_int_vector, acc |= value) break;
+        case REDUCE_XOR: REDUCE_LOOP(reduce_int_vector, acc ^= value) break;
+    }
+    pc_int result = acc[0];
+    for (pc_int lane = 1; lane < REDUCE_LANES; ++lane) {
+        result = reduce_int_scalar(op, result, acc[lane]);
+    }
+    for (; i < length; ++i) {
+        result = reduce_int_scalar(op, result, data[i]);
+    }
+    return result;
+}
+
+static pc_float reduce_float_identity(pc_int op) {
+    switch (op) {
+        case REDUCE_MIN: return INFINITY;
+        case REDUCE_MAX: return -INFINITY;
+        default: return 0.0;
+    }
+}
+
+static pc_float reduce_float_scalar(pc_int op, pc_float lhs, pc_float rhs) {
+    switch (op) {
+        case REDUCE_MIN: return lhs < rhs ? lhs : rhs;
+        case REDUCE_MAX: return lhs > rhs ? lhs : rhs;
+        default: return lhs + rhs;
+    }
+}
+
+static pc_float reduce_float_chunk(const pc_float* data, pc_int length, pc_int op) {
+    reduce_float_vector acc = (reduce_float_vector) {0} + reduce_float_identity(op);
+    pc_int i = 0;
+    switch (op) {
+        case REDUCE_SUM: REDUCE_LOOP(reduce_float_vector, acc += value) break;
+        case REDUCE_MIN: REDUCE_LOOP(reduce_float_vector, reduce_int_vector less = acc < value;
+            acc = (reduce_float_vector) (((reduce_int_vector) acc & less) | ((reduce_int_vector) value & ~less))) break;
+        case REDUCE_MAX: REDUCE_LOOP(reduce_float_vector, reduce_int_vector more = acc > value;
+            acc = (reduce_float_vector) (((reduce_int_vector) acc & more) | ((reduce_int_vector) value & ~more))) break;
+    }
+    pc_float result = acc[0];
+    for (pc_int lane = 1; lane < REDUCE_LANES; ++lane) {
+        result = reduce_float_scalar(op, result, acc[lane]);
+    }
+    for (; i < length; ++i) {
+        result = reduce_float_scalar(op, result, data[i]);
+    }
+    return result;
+}
+
+static pc_none* reduce_int_routine(pc_none* task_, pc_int offset, pc_int length) {
+    reduce_task* task = task_;
+    reduce_value partial = {.i = reduce_int_chunk((pc_int*) task->data + offset, length, task->op)};
+    return partial.boxed;
+}
+
+static pc_none* reduce_float_routine(pc_none* task_, pc_int offset, pc_int length) {
+    reduce_task* task = task_;
+    reduce_value partial = {.f = reduce_float_chunk((pc_float*) task->data + offset, length, task->op)};
+    return partial.boxed;
+}
+
+static pc_none** reduce_parallel(reduce_task* task, pc_int length, pc_none *(*routine)(pc_none *, pc_int, pc_int)) {
+    pc_int grain = parallel_grain(length);
+    return parallel_for_grain(task, length, grain > REDUCE_GRAIN ? grain : REDUCE_GRAIN, routine);
+}
+
+static pc_int reduce_int(pc_int* data, pc_int length, pc_int op) {
+    pc_int result = reduce_int_identity(op);
+    if (length <= 0) return result;
+    reduce_task task = {data, op};
+    pc_none** partials = reduce_parallel(&task, length, reduce_int_routine);
+    for (pc_int i = 0; i < (pc_int) partials[-1]; ++i) {
+        reduce_value partial = {.boxed = partials[i]};
+        result = reduce_int_scalar(op, result, partial.i);
+    }
+    dealloc(partials - 1);
+    return result;
+}
+
+static pc_float reduce_float(pc_float* data, pc_int length, pc_int op) {
+    pc_float result = reduce_float_identity(op);
+    if (length <= 0) return result;
+    reduce_task task = {data, op};
+    pc_none** partials = reduce_parallel(&task, length, reduce_float_routine);
+    for (pc_int i = 0; i < (pc_int) partials[-1]; ++i) {
+        reduce_value partial = {.boxed = partials[i]};
+        result = reduce_float_scalar(op, result, partial.f);
+    }
+    dealloc(partials - 1);
+    return result;
+}
+
+pc_int reduce_sum_int(pc_int* data, pc_int length) {
+    return reduce_int(data, length, REDUCE_SUM);
+}
+
+pc_int reduce_min_int(pc_int* data, pc_int length) {
+    return reduce_int(data, length, REDUCE_MIN);
+}
+
+pc_int reduce_max_int(pc_int* data, pc_int length) {
+    return reduce_int(data, length, REDUCE_MAX);
+}
+
+pc_float reduce_sum_float(pc_float* data, pc_int length) {
+    return reduce_float(data, length, REDUCE_SUM);
+}
+
+pc_float reduce_min_float(pc_float* data, pc_int length) {
+    return reduce_float(data, length, REDUCE_MIN);
+}
+
+pc_float reduce_max_float(pc_float* data, pc_int length) {
+    return reduce_float(data, length, REDUCE_MAX);
+}
+
+pc_int reduce_with(pc_int* data, pc_int length, pc_int op) {
+    if (op < REDUCE_SUM || op > REDUCE_XOR) {
+        fprintf(stderr, "reduce_with: unknown operator %ld\n", op);
+        exit(1);
+    }
+    return reduce_int(data, length, op);
+}
+
+
+/*
+ * Parallel sorting. Integers and floats are mapped to unsigned keys that order the same
+ * way and sorted by a least significant digit radix sort, where the workers histogram
+ * and scatter equal slices of the array for every byte. Passes in which all the keys
+ * share the same byte are skipped. Other element types go through a stable merge sort:
+ * the workers sort runs of the array independently, and every round of merging is cut
+ * into equal slices of the output, whose inputs are located by binary search.
+ */
+
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+// below this many elements per slice, waking up workers costs more than it saves
+#define SORT_GRAIN 16384
+
+typedef struct {
+    pc_u64* keys;
+    pc_u64* buffer;
+    pc_int length;
+    pc_int grain;
+    pc_int shift;
+    pc_int* counts; // RADIX_BUCKETS counters per slice, turned into offsets before scattering
+} radix_task;
+
+static pc_int sort_grain(pc_int length) {
+    pc_int threads = thread_count();
+    if (length / threads < SORT_GRAIN) threads = length / SORT_GRAIN > 0 ? length / SORT_GRAIN : 1;
+    return length / threads + (length % threads != 0);
+}
+
+static pc_none* radix_count_routine(pc_none* task_, pc_int offset, pc_int length) {
+    radix_task* task = task_;
+    pc_int* counts = task->counts + offset / task->grain * RADIX_BUCKETS;
+    memset(counts, 0, sizeof(pc_int) * RADIX_BUCKETS);
+    for (pc_int i = offset; i < offset + length; ++i) {
+        ++counts[task->keys[i] >> task->shift & (RADIX_BUCKETS - 1)];
+    }
+    return NULL;
+}
+
+static pc_none* radix_scatter_routine(pc_none* task_, pc_int offset, pc_int length) {
+    radix_task* task = task_;
+    pc_int* offsets = task->counts + offset / task->grain * RADIX_BUCKETS;
+    for (pc_int i = offset; i < offset + length; ++i) {
+        pc_u64 key = task->keys[i];
+        task->buffer[offsets[key >> task->shift & (RADIX_BUCKETS - 1)]++] = key;
+    }
+    return NULL;
+}
+
+static void radix_sort(pc_u64* keys, pc_int length) {
+    pc_int grain = sort_grain(length);
+    pc_int slices = length / grain + (length % grain != 0);
+    radix_task task = {keys, malloc(sizeof(pc_u64) * length), length, grain, 0,
+        malloc(sizeof(pc_int) * RADIX_BUCKETS * slices)};
+    for (task.shift = 0; task.shift < 64; task.shift += RADIX_BITS) {
+        dealloc(parallel_for_grain(&task, length, grain, radix_count_routine) - 1);
+        pc_int offset = 0;
+        pc_bool skip = 0;
+        for (pc_int digit = 0; digit < RADIX_BUCKETS && !skip; ++digit) {
+            pc_int begin = offset;
+            for (pc_int slice = 0; slice < slices; ++slice) {
+                pc_int count = task.counts[slice * RADIX_BUCKETS + digit];
+                task.counts[slice * RADIX_BUCKETS + digit] = offset;
+                offset += count;
+            }
+            skip = offset - begin == length;
+        }
+        if (skip) continue;
+        dealloc(parallel_for_grain(&task, length, grain, radix_scatter_routine) - 1);
+        pc_u64* sorted = task.buffer;
+        task.buffer = task.keys;
+        task.keys = sorted;
+    }
+    if (task.keys != keys) {
+        memcpy(keys, task.keys, sizeof(pc_u64) * length);
+        task.buffer = task.keys;
+    }
+    free(task.buffer);
+    free(task.counts);
+}
+
+static pc_none* sort_encode_int_routine(pc_none* keys, pc_int offset, pc_int length) {
+    for (pc_int i = offset; i < offset + length; ++i) {
+        ((pc_u64*) keys)[i] ^= (pc_u64) 1 << 63;
+    }
+    return NULL;
+}
+
+static pc_none* sort_encode_float_routine(pc_none* keys, pc_int offset, pc_int length) {
+    for (pc_int i = offset; i < offset + length; ++i) {
+        pc_u64 key = ((pc_u64*) keys)[i];
+        ((pc_u64*) keys)[i] = key >> 63 ? ~key : key | (pc_u64) 1 << 63;
+    }
+    return NULL;
+}
+
+static pc_none* sort_decode_float_routine(pc_none* keys, pc_int offset, pc_int length) {
+    for (pc_int i = offset; i < offset + length; ++i) {
+        pc_u64 key = ((pc_u64*) keys)[i];
+        ((pc_u64*) keys)[i] = key >> 63 ? key & ~((pc_u64) 1 << 63) : ~key;
+    }
+    return NULL;
+}
+
+pc_none parallel_sort_int(pc_int* data, pc_int length) {
+    if (length < 2) return;
+    pc_int grain = sort_grain(length);
+    dealloc(parallel_for_grain(data, length, grain, sort_encode_int_routine) - 1);
+    radix_sort((pc_u64*) data, length);
+    dealloc(parallel_for_grain(data, length, grain, sort_encode_int_routine) - 1);
+}
+
+pc_none parallel_sort_float(pc_float* data, pc_int length) {
+    if (length < 2) return;
+    pc_int grain = sort_grain(length);
+    dealloc(parallel_for_grain(data, length, grain, sort_encode_float_routine) - 1);
+    radix_sort((pc_u64*) data, length);
+    dealloc(parallel_for_grain(data, length, grain, sort_decode_float_routine) - 1);
+}
+
+typedef struct {
+    pc_u8* source;
+    pc_u8* target;
+    pc_int size;
+    pc_int length;
+    pc_int width; // length of the sorted runs being merged
+    pc_bool (*cmp)(pc_none *, pc_none *);
+} merge_task;
+
+// the number of elements taken from lhs among the first k elements of the stable merge
+static pc_int merge_rank(merge_task* task, pc_int k, pc_u8* lhs, pc_int m, pc_u8* rhs, pc_int n) {
+    pc_int low = k > n ? k - n : 0, high = k < m ? k : m;
+    while (low < high) {
+        pc_int i = low + (high - low) / 2;
+        if (task->cmp(rhs + (k - i - 1) * task->size, lhs + i * task->size)) {
+            high = i;
+        } else {
+            low = i + 1;
+        }
+    }
+    return low;
+}
+
+static void merge(merge_task* task, pc_u8* lhs, pc_u8* lhs_end, pc_u8* rhs, pc_u8* rhs_end, pc_u8* target) {
+    pc_int size = task->size;
+    while (lhs < lhs_end && rhs < rhs_end) {
+        if (task->cmp(rhs, lhs)) {
+            memcpy(target, rhs, size);
+            rhs += size;
+        } else {
+            memcpy(target, lhs, size);
+            lhs += size;
+        }
+        target += size;
+    }
+    memcpy(target, lhs, lhs_end - lhs);
+    memcpy(target + (lhs_end - lhs), rhs, rhs_end - rhs);
+}
+
+static pc_none* merge_routine(pc_none* task_, pc_int offset, pc_int length) {
+    merge_task* task = task_;
+    pc_int size = task->size, end = offset + length;
+    while (offset < end) {
+        // the slice may span the outputs of several pairs of runs
+        pc_int low = offset / (task->width * 2) * (task->width * 2);
+        pc_int middle = low + task->width < task->length ? low + task->width : task->length;
+        pc_int high = middle + task->width < task->length ? middle + task->width : task->length;
+        pc_int stop = end < high ? end : high;
+        pc_u8* lhs = task->source + low * size;
+        pc_u8* rhs = task->source + middle * size;
+        pc_int first = merge_rank(task, offset - low, lhs, middle - low, rhs, high - middle);
+        pc_int last = merge_rank(task, stop - low, lhs, middle - low, rhs, high - middle);
+        merge(task, lhs + first * size, lhs + last * size,
+            rhs + (offset - low - first) * size, rhs + (stop - low - last) * size, task->target + offset * size);
+        offset = stop;
+    }
+    return NULL;
+}
+
+static pc_none* sort_run_routine(pc_none* task_, pc_int offset, pc_int length) {
+    merge_task* task = task_;
+    pc_int size = task->size;
+    pc_u8* base = task->source + offset * size;
+    pc_u8* scratch = task->target + offset * size;
+    pc_u8* element = malloc(size);
+    // binary insertion sort of short runs, then merge them bottom-up
+    const pc_int run = 16;
+    for (pc_int begin = 0; begin < length; begin += run) {
+        pc_int end = begin + run < length ? begin + run : length;
+        for (pc_int i = begin + 1; i < end; ++i) {
+            pc_int low = begin, high = i;
+            while (low < high) {
+                pc_int j = low + (high - low) / 2;
+                if (task->cmp(base + i * size, base + j * size)) high = j; else low = j + 1;
+            }
+            memcpy(element, base + i * size, size);
+            memmove(base + (low + 1) * size, base + low * size, (i - low) * size);
+            memcpy(base + low * size, element, size);
+        }
+    }
+    free(element);
+    for (pc_int width = run; width < length; width *= 2) {
+        for (pc_int low = 0; low < length; low += width * 2) {
+            pc_int middle = low + width < length ? low + width : length;
+            pc_int high = middle + width < length ? middle + width : length;
+            merge(task, base + low * size, base + middle * size, base + middle * size, base + high * size,
+                scratch + low * size);
+        }
+        pc_u8* sorted = scratch;
+        scratch = base;
+        base = sorted;
+    }
+    if (base != task->source + offset * size) {
+        memcpy(scratch, base, length * size);
+    }
+    return NULL;
+}
+
+pc_none parallel_sort(pc_none* data, pc_int size, pc_int length, pc_bool (*cmp)(pc_none *, pc_none *)) {
+    if (length < 2) return;
+    merge_task task = {data, malloc(size * length), size, length, sort_grain(length), cmp};
+    dealloc(parallel_for_grain(&task, length, task.width, sort_run_routine) - 1);
+    for (; task.width < length; task.width *= 2) {
+        dealloc(parallel_for_grain(&task, length, sort_grain(length), merge_routine) - 1);
+        pc_u8* sorted = task.target;
+        task.target = task.source;
+        task.source = sorted;
+    }
+    if (task.source != data) {
+        memcpy(data, task.source, size * length);
+        task.target = task.source;
+    }
+    free(task.target);
+}
+
+
+/*
+ * Arenas hand out memory by bumping a cursor through large chunks and free everything
+ * at once. A reset arena keeps its chunks and refills them from the first one, so
+ * programs working in phases stop calling malloc after the first phase.
+ */
+
+#define ARENA_DEFAULT_ALIGN 16
+#define ARENA_LOCAL_CAPACITY (64 * 1024)
+
+typedef struct arena_chunk {
+    struct arena_chunk* next;
+    pc_int capacity;
+    _Alignas(ARENA_DEFAULT_ALIGN) pc_u8 data[];
+} arena_chunk;
+
+typedef struct {
+    arena_chunk* first;
+    arena_chunk* chunk; // the chunk being filled
+    pc_u8* cursor;
+    pc_u8* end;
+    pc_int capacity;
+} arena;
+
+static arena_chunk* arena_chunk_create(pc_int capacity, arena_chunk* next) {
+    arena_chunk* chunk = malloc(sizeof(arena_chunk) + capacity);
+    if (chunk == NULL) return NULL;
+    chunk->next = next;
+    chunk->capacity = capacity;
+    return chunk;
+}
+
+static void arena_enter(arena* arena, arena_chunk* chunk) {
+    arena->chunk = chunk;
+    arena->cursor = chunk->data;
+    arena->end = chunk->data + chunk->capacity;
+}
+
+pc_none* arena_create(pc_int capacity) {
+    arena* arena = malloc(sizeof(*arena));
+    if (arena == NULL) return NULL;
+    arena->capacity = capacity > 0 ? capacity : ARENA_LOCAL_CAPACITY;
+    arena->first = arena_chunk_create(arena->capacity, NULL);
+    if (arena->first == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena_enter(arena, arena->first);
+    return arena;
+}
+
+// slow path, the current chunk is full: move on to a spare chunk left by a reset or add a new one
+static pc_none* arena_grow(arena* arena, pc_int size, pc_int align) {
+    pc_int needed = size + align - 1;
+    arena_chunk* next = arena->chunk->next;
+    if (next == NULL || next->capacity < needed) {
+        next = arena_chunk_create(needed > arena->capacity ? needed : arena->capacity, next);
+        if (next == NULL) return NULL;
+        arena->chunk->next = next;
+    }
+    arena_enter(arena, next);
+    pc_u8* result = (pc_u8*) (((uintptr_t) arena->cursor + align - 1) & -(uintptr_t) align);
+    arena->cursor = result + size;
+    return result;
+}
+
+pc_none* arena_alloc(pc_none* arena_, pc_int size, pc_int align) {
+    arena* arena = arena_;
+    if (align <= 0) align = ARENA_DEFAULT_ALIGN;
+    uintptr_t result = ((uintptr_t) arena->cursor + align - 1) & -(uintptr_t) align;
+    if (result > (uintptr_t) arena->end || (uintptr_t) arena->end - result < (uintptr_t) size) {
+        return arena_grow(arena, size, align);
+    }
+    arena->cursor = (pc_u8*) result + size;
+    return (pc_none*) result;
+}
+
+pc_none arena_reset(pc_none* arena_) {
+    arena* arena = arena_;
+    arena_enter(arena, arena->first);
+}
+
+pc_none arena_destroy(pc_none* arena_) {
+    arena* arena = arena_;
+    for (arena_chunk* chunk = arena->first; chunk; ) {
+        arena_chunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+static struct {
+    pthread_once_t once;
+    pthread_key_t key;
+} arena_locals = {PTHREAD_ONCE_INIT};
+
+static void arena_locals_init(void) {
+    pthread_key_create(&arena_locals.key, arena_destroy);
+}
+
+pc_none* arena_local() {
+    pthread_once(&arena_locals.once, arena_locals_init);
+    pc_none* arena = pthread_getspecific(arena_locals.key);
+    if (arena == NULL) {
+        arena = arena_create(ARENA_LOCAL_CAPACITY);
+        pthread_setspecific(arena_locals.key, arena);
+    }
+    return arena;
+}
+
+
+/*
+ * Input is read into a large buffer per file descriptor, kept between calls, so that
+ * consecutive reads continue where the last one stopped. Only the bytes up to the last
+ * separator in the buffer are parsed, a number cut off by the end of the buffer waits
+ * for the next refill. Digits are scanned and converted eight at a time within a 64-bit
+ * word, and floats with at most 19 significant digits and a small exponent are computed
+ * exactly from their decimal mantissa, others fall back to strtod. Any byte that cannot
+ * be part of a number separates numbers.
+ */
+
+#define INPUT_CAPACITY (1024 * 1024)
+// loads of eight bytes may run past the data, which stays zero-terminated
+#define INPUT_PADDING 8
+
+typedef struct input_buffer {
+    int fd;
+    pc_bool eof;
+    pc_int begin;
+    pc_int end;
+    struct input_buffer* next;
+    char data[INPUT_CAPACITY + INPUT_PADDING];
+} input_buffer;
+
+static struct {
+    pthread_mutex_t lock; // held for the whole of a read, guards the list
+    input_buffer* buffers;
+} input = {PTHREAD_MUTEX_INITIALIZER};
+
+static input_buffer* input_find(int fd) {
+    for (input_buffer* buffer = input.buffers; buffer; buffer = buffer->next) {
+        if (buffer->fd == fd) return buffer;
+    }
+    input_buffer* buffer = malloc(sizeof(input_buffer));
+    buffer->fd = fd;
+    buffer->eof = 0;
+    buffer->begin = buffer->end = 0;
+    memset(buffer->data, 0, INPUT_PADDING);
+    buffer->next = input.buffers;
+    return input.buffers = buffer;
+}
+
+static void input_drop(int fd) {
+    for (input_buffer** link = &input.buffers; *link; link = &(*link)->next) {
+        if ((*link)->fd == fd) {
+            input_buffer* buffer = *link;
+            *link = buffer->next;
+            free(buffer);
+            return;
+        }
+    }
+}
+
+// moves the unparsed bytes to the front and reads more after them, false at the end of input
+static pc_bool input_fill(input_buffer* buffer) {
+    if (buffer->eof) return 0;
+    memmove(buffer->data, buffer->data + buffer->begin, buffer->end - buffer->begin);
+    buffer->end -= buffer->begin;
+    buffer->begin = 0;
+    ssize_t result = read(buffer->fd, buffer->data + buffer->end, INPUT_CAPACITY - buffer->end);
+    if (result <= 0) buffer->eof = 1; else buffer->end += result;
+    memset(buffer->data + buffer->end, 0, INPUT_PADDING);
+    return 1;
+}
+
+// the end of the whole numbers in the buffer, the bytes after the last separator may continue
+static char* input_limit(input_buffer* buffer, const char* alphabet) {
+    char* begin = buffer->data + buffer->begin;
+    char* limit = buffer->data + buffer->end;
+    if (buffer->eof) return limit;
+    while (limit > begin && limit[-1] && strchr(alphabet, limit[-1])) --limit;
+    // a full buffer without any separator cannot grow, so its bytes are taken as they are
+    return limit == buffer->data && buffer->end == INPUT_CAPACITY ? buffer->data + buffer->end : limit;
+}
+
+static pc_int input_digits(const char* p) {
+    pc_u64 word;
+    memcpy(&word, p, sizeof(word));
+    // a byte is a digit if its high nibble is 3 and its low nibble is at most 9
+    pc_u64 bad = ((word & 0xF0F0F0F0F0F0F0F0) ^ 0x3030303030303030)
+        | (((word & 0x0F0F0F0F0F0F0F0F) + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0);
+    pc_u64 nonzero = (((bad & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F) | bad) & 0x8080808080808080;
+    return nonzero ? __builtin_ctzll(nonzero) / 8 : 8;
+}
+
+// converts the first count of the eight digits in p, count > 0
+static pc_u64 input_convert(const char* p, pc_int count) {
+    pc_u64 word;
+    memcpy(&word, p, sizeof(word));
+    // the digits left out become leading zeros, then pairs, quads and octets of digits are combined
+    word = (word & 0x0F0F0F0F0F0F0F0F) << (8 * (8 - count));
+    word = (word * (10 * 256 + 1)) >> 8 & 0x00FF00FF00FF00FF;
+    word = (word * (100 * 65536 + 1)) >> 16 & 0x0000FFFF0000FFFF;
+    return (word * (10000 * 4294967296ul + 1)) >> 32;
+}
+
+static const pc_u64 powers_of_ten[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+// accumulates up to 19 significant digits, counting the ones that do not fit into dropped
+static const char* input_mantissa(const char* p, pc_u64* mantissa, pc_int* digits, pc_int* dropped) {
+    pc_int count;
+    while ((count = input_digits(p)) > 0) {
+        if (*digits + count <= 19) {
+            *mantissa = *mantissa * powers_of_ten[count] + input_convert(p, count);
+            *digits += count;
+        } else {
+            *dropped += count;
+        }
+        p += count;
+        if (count < 8) break;
+    }
+    return p;
+}
+
+#define INPUT_IS_DIGIT(c) ((unsigned) ((c) - '0') < 10)
+
+#define INPUT_LOOP(fd, max, alphabet, start, parse) \
+    pthread_mutex_lock(&input.lock); \
+    input_buffer* buffer = input_find(fd); \
+    char* p = buffer->data + buffer->begin; \
+    char* limit = input_limit(buffer, alphabet); \
+    pc_int count = 0; \
+    while (count < max) { \
+        if (p >= limit) { \
+            buffer->begin = p - buffer->data; \
+            if (!input_fill(buffer)) break; \
+            p = buffer->data; \
+            limit = input_limit(buffer, alphabet); \
+            continue; \
+        } \
+        if (start) { \
+            parse; \
+        } else { \
+            ++p; \
+        } \
+    } \
+    buffer->begin = p - buffer->data; \
+    if (buffer->eof && buffer->begin == buffer->end) input_drop(buffer->fd); \
+    pthread_mutex_unlock(&input.lock); \
+    return count;
+
+pc_int read_int_array(pc_int fd, pc_int* array, pc_int max) {
+    INPUT_LOOP(fd, max, "+-0123456789",
+        INPUT_IS_DIGIT(*p) || ((*p == '-' || *p == '+') && INPUT_IS_DIGIT(p[1])), {
+        pc_bool negative = *p == '-';
+        if (*p == '-' || *p == '+') ++p;
+        pc_u64 value = 0;
+        pc_int n;
+        while ((n = input_digits(p)) > 0) {
+            value = value * powers_of_ten[n] + input_convert(p, n);
+            p += n;
+            if (n < 8) break;
+        }
+        array[count++] = negative ? -value : value;
+    })
+}
+
+static const pc_float exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const char* input_float(const char* p, pc_float* result) {
+    const char* begin = p;
+    pc_bool negative = *p == '-';
+    if (*p == '-' || *p == '+') ++p;
+    pc_u64 mantissa = 0;
+    pc_int digits = 0, dropped = 0, exponent = 0;
+    p = input_mantissa(p, &mantissa, &digits, &dropped);
+    exponent += dropped;
+    if (*p == '.') {
+        pc_int before = digits;
+        p = input_mantissa(p + 1, &mantissa, &digits, &dropped);
+        exponent -= digits - before;
+    }
+    if ((*p == 'e' || *p == 'E') && (INPUT_IS_DIGIT(p[1]) || ((p[1] == '-' || p[1] == '+') && INPUT_IS_DIGIT(p[2])))) {
+        ++p;
+        pc_bool minus = *p == '-';
+        if (*p == '-' || *p == '+') ++p;
+        pc_int value = 0;
+        while (INPUT_IS_DIGIT(*p)) {
+            if (value < 100000) value = value * 10 + *p - '0';
+            ++p;
+        }
+        exponent += minus ? -value : value;
+    }
+    if (dropped == 0 && mantissa <= (1ul << 53) && exponent >= -22 && exponent <= 22) {
+        // both the mantissa and the power are exact, so a single rounding gives the right result
+        pc_float value = (pc_float) mantissa;
+        value = exponent < 0 ? value / exact_powers_of_ten[-exponent] : value * exact_powers_of_ten[exponent];
+        *result = negative ? -value : value;
+    } else {
+        char copy[64];
+        char* token = p - begin < (pc_int) sizeof(copy) ? copy : malloc(p - begin + 1);
+        memcpy(token, begin, p - begin);
+        token[p - begin] = '\0';
+        *result = strtod(token, NULL);
+        if (token != copy) free(token);
+    }
+    return p;
+}
+
+pc_int read_float_array(pc_int fd, pc_float* array, pc_int max) {
+    INPUT_LOOP(fd, max, "+-.0123456789eE",
+        INPUT_IS_DIGIT(*p) || (*p == '.' && INPUT_IS_DIGIT(p[1]))
+            || ((*p == '-' || *p == '+') && (INPUT_IS_DIGIT(p[1]) || (p[1] == '.' && INPUT_IS_DIGIT(p[2])))), {
+        pc_float value;
+        p = (char*) input_float(p, &value);
+        array[count++] = value;
+    })
+}
+
+pc_int file_size(pc_u8* path) {
+    struct stat info;
+    return stat((const char*) path, &info) == 0 ? info.st_size : -1;
+}
+
+pc_int open_file(pc_u8* path, pc_bool writable) {
+    int fd = open((const char*) path, writable ? O_WRONLY | O_CREAT | O_TRUNC : O_RDONLY, 0644);
+    if (fd >= 0 && !writable) posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    return fd;
+}
+
+pc_none close_file(pc_int fd) {
+    pthread_mutex_lock(&input.lock);
+    input_drop(fd);
+    pthread_mutex_unlock(&input.lock);
+    close(fd);
+}
+
+/*
+ * Files mapped into memory are handed to Porkchop as []u8 slices, whose pointer and
+ * length travel in two registers just like this struct. Advice and synchronization
+ * accept any slice of a mapping and widen it to whole pages.
+ */
+
+typedef struct {
+    pc_u8* data;
+    pc_int length;
+} pc_slice;
+
+pc_slice map_file(pc_u8* path, pc_bool writable) {
+    pc_slice file = {NULL, 0};
+    int fd = open((const char*) path, writable ? O_RDWR : O_RDONLY);
+    if (fd < 0) return file;
+    struct stat info;
+    // empty files cannot be mapped and come back as empty slices like missing ones
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        pc_none* data = mmap(NULL, info.st_size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED) {
+            file.data = data;
+            file.length = info.st_size;
+        }
+    }
+    // the mapping outlives the descriptor
+    close(fd);
+    return file;
+}
+
+pc_none unmap_file(pc_slice file) {
+    if (file.data) munmap(file.data, file.length);
+}
+
+static pc_slice map_pages(pc_slice range) {
+    uintptr_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (uintptr_t) range.data & -page;
+    return (pc_slice) {(pc_u8*) begin, (uintptr_t) range.data + range.length - begin};
+}
+
+pc_none map_advise(pc_slice range, pc_int advice) {
+    // indexed by the map_* constants of stdlib.pc
+    static const int advices[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+    if (range.data == NULL || advice < 0 || advice >= (pc_int) (sizeof(advices) / sizeof(*advices))) return;
+    pc_slice pages = map_pages(range);
+    madvise(pages.data, pages.length, advices[advice]);
+}
+
+pc_none sync_file(pc_slice range) {
+    if (range.data == NULL) return;
+    pc_slice pages = map_pages(range);
+    msync(pages.data, pages.length, MS_SYNC);
+}
@@ -21,17 +21,30 @@ void LocalContext::local(std::string_view name, const TypeReference& type) {
     localTypes.push_back(type);
 }
 
+void LocalContext::array(std::string_view name) {
+    if (name == "_") return;
+    localArrays.insert(localIndices.back().at(std::string(name)));
+}
+
 LocalContext::LookupResult LocalContext::lookup(Compiler& compiler, Token token) const {
     std::string name(compiler.of(token));
     if (name == "_") return {ScalarTypes::NONE, 0, LookupResult::Scope::NONE};
     for (auto it = localIndices.rbegin(); it != localIndices.rend(); ++it) {
         if (auto lookup = it->find(name); lookup != it->end()) {
             size_t index = lookup->second;
-            return {localTypes[index - offset], index, LookupResult::Scope::LOCAL};
+            return {localTypes[index - offset], index, LookupResult::Scope::LOCAL, localArrays.contains(index)};
         }
     }
     return global->lookup(name, token);
 }
 
+bool LocalContext::declared(std::string_view name) const {
+    std::string key(name);
+    for (auto&& indices : localIndices) {
+        if (indices.contains(key)) return true;
+    }
+    return global->global.contains(key);
+}
+
 
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_set>
+
 #include "type.hpp"
 #include "compiler.hpp"
 
@@ -8,6 +10,7 @@ namespace Porkchop {
 struct LocalContext {
     std::vector<std::unordered_map<std::string, size_t>> localIndices{{}};
     std::vector<TypeReference> localTypes;
+    std::unordered_set<size_t> localArrays; // locals bound to a constant array
 
     GlobalScope* global;
 
@@ -18,6 +21,7 @@ struct LocalContext {
     void push();
     void pop();
     void local(std::string_view name, TypeReference const& type);
+    void array(std::string_view name);
 
     struct LookupResult {
         TypeReference type;
@@ -25,9 +29,11 @@ struct LocalContext {
         enum class Scope {
             NONE, LOCAL, GLOBAL
         } scope;
+        bool array = false; // a local bound to a constant array
     };
 
     [[nodiscard]] LookupResult lookup(Compiler& compiler, Token token) const;
+    [[nodiscard]] bool declared(std::string_view name) const;
 
     struct Guard {
         LocalContext& context;
@@ -21,6 +21,12 @@ std::unordered_map<std::string, std::string> parseArgs(int argc, const char* arg
             args["type"] = "llvm-ir";
         } else if (!strcmp("-g", argv[i]) || !strcmp("--debug", argv[i])) {
             Porkchop::Assembler::debug_flag = true;
+        } else if (!strcmp("-b", argv[i]) || !strcmp("--bounds-check", argv[i])) {
+            Porkchop::Assembler::bounds_flag = true;
+        } else if (!strcmp("-t", argv[i]) || !strcmp("--trapv", argv[i])) {
+            Porkchop::Assembler::trapv_flag = true;
+        } else if (!strcmp("-ffast-math", argv[i]) || !strcmp("--fast-math", argv[i])) {
+            Porkchop::Assembler::fast_math_flag = true;
         } else {
             Porkchop::Error().with(
                     Porkchop::ErrorMessage().fatal().text("unknown flag: ").text(argv[i])
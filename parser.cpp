@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "parser.hpp"
 #include "global.hpp"
 #include "lexer.hpp"
@@ -180,7 +182,16 @@ ExprHandle Parser::parseExpression(Expr::Level level) {
                     }
                     case TokenType::LBRACKET: {
                         auto token1 = next();
-                        auto rhs = parseExpression();
+                        ExprHandle rhs;
+                        if (peek().type != TokenType::OP_COLON) rhs = parseExpression();
+                        if (peek().type == TokenType::OP_COLON) {
+                            next();
+                            ExprHandle end;
+                            if (peek().type != TokenType::RBRACKET) end = parseExpression();
+                            auto token2 = expect(TokenType::RBRACKET, "]");
+                            lhs = make<SliceExpr>(token1, token2, std::move(lhs), std::move(rhs), std::move(end));
+                            break;
+                        }
                         auto token2 = expect(TokenType::RBRACKET, "]");
                         lhs = make<AccessExpr>(token1, token2, std::move(lhs), std::move(rhs));
                         break;
@@ -224,8 +235,17 @@ ExprHandle Parser::parseExpression(Expr::Level level) {
                 }
                 case TokenType::LBRACE:
                     return parseClause();
+                case TokenType::LBRACKET: {
+                    next();
+                    auto elements = parseExpressions(TokenType::RBRACKET);
+                    auto token2 = next();
+                    return make<ArrayExpr>(token, token2, std::move(elements));
+                }
 
                 case TokenType::IDENTIFIER:
+                    if (BUILTINS.contains(compiler.of(token)) && !context.declared(compiler.of(token))) {
+                        return parseBuiltin();
+                    }
                     return parseId(true);
 
                 case TokenType::KW_FALSE:
@@ -250,6 +270,8 @@ ExprHandle Parser::parseExpression(Expr::Level level) {
                     return parseWhile();
                 case TokenType::KW_IF:
                     return parseIf();
+                case TokenType::KW_MATCH:
+                    return parseMatch();
                 case TokenType::KW_LET:
                     return parseLet(false);
 
@@ -306,6 +328,29 @@ std::vector<ExprHandle> Parser::parseExpressions(TokenType stop) {
     return expr;
 }
 
+ExprHandle Parser::parseBuiltin() {
+    auto token1 = next();
+    auto builtin = BUILTINS.at(compiler.of(token1));
+    expect(TokenType::LPAREN, "(");
+    std::vector<ExprHandle> rhs;
+    std::optional<Token> order;
+    while (true) {
+        if (peek().type == TokenType::RPAREN) break;
+        if (order) raise("memory order must be the last argument", peek());
+        if (auto token = peek(); token.type == TokenType::IDENTIFIER
+                && MEMORY_ORDERS.contains(compiler.of(token)) && !context.declared(compiler.of(token))) {
+            order = next();
+        } else {
+            rhs.emplace_back(parseExpression());
+        }
+        if (peek().type == TokenType::RPAREN) break;
+        expectComma();
+    }
+    optionalComma(rhs.size() + order.has_value());
+    auto token2 = next();
+    return make<BuiltinExpr>(token1, token2, builtin, std::move(rhs), order);
+}
+
 ExprHandle Parser::parseIf() {
     auto token = next();
     LocalContext::Guard guard(context);
@@ -319,6 +364,42 @@ ExprHandle Parser::parseIf() {
     return make<IfElseExpr>(token, std::move(cond), std::move(clause), make<ClauseExpr>(rewind(), rewind()));
 }
 
+ExprHandle Parser::parseMatch() {
+    auto token = next();
+    auto cond = parseExpression();
+    expect(TokenType::LBRACE, "{");
+    std::vector<MatchExpr::Arm> arms;
+    ExprHandle otherwise;
+    while (true) {
+        while (peek().type == TokenType::LINEBREAK) next();
+        if (peek().type == TokenType::RBRACE) break;
+        if (peek().type == TokenType::KW_ELSE) {
+            auto token2 = next();
+            if (otherwise) raise("duplicate else arm in match", token2);
+            expect(TokenType::OP_COLON, ":");
+            otherwise = parseExpression();
+        } else {
+            std::vector<ExprHandle> labels;
+            labels.emplace_back(parseExpression());
+            while (peek().type == TokenType::OP_COMMA) {
+                next();
+                labels.emplace_back(parseExpression());
+            }
+            expect(TokenType::OP_COLON, ":");
+            arms.push_back({std::move(labels), parseExpression()});
+        }
+        switch (peek().type) {
+            default: raise("a linebreak is expected between arms", peek());
+            case TokenType::RBRACE:
+            case TokenType::LINEBREAK:
+                continue;
+        }
+    }
+    auto token2 = next();
+    if (arms.empty() && !otherwise) raise("match must have at least one arm", token2);
+    return make<MatchExpr>(token, token2, std::move(cond), std::move(arms), std::move(otherwise));
+}
+
 ExprHandle Parser::parseWhile() {
     auto token = next();
     pushLoop();
@@ -332,25 +413,32 @@ std::unique_ptr<ParameterList> Parser::parseParameters() {
     expect(TokenType::LPAREN, "(");
     std::vector<IdExprHandle> identifiers;
     std::vector<TypeReference> P;
+    std::vector<bool> restricts;
     while (true) {
         if (peek().type == TokenType::RPAREN) break;
-        auto declarator = parseDeclarator();
+        auto declarator = parseDeclarator(true);
         if (declarator->designated == nullptr) {
             raise("missing type for the parameter", declarator->segment);
         }
+        if (declarator->restricted && !isPointer(declarator->designated)) {
+            raise("only parameters of pointer type can be restrict", declarator->segment);
+        }
         identifiers.push_back(std::move(declarator->name));
         P.push_back(std::move(declarator->designated));
+        restricts.push_back(declarator->restricted);
         if (peek().type == TokenType::RPAREN) break;
         expectComma();
     }
     optionalComma(identifiers.size());
     next();
-    return std::make_unique<ParameterList>(std::move(identifiers), std::make_shared<FuncType>(std::move(P),nullptr));
+    if (std::count(restricts.begin(), restricts.end(), true) == 0) restricts.clear();
+    return std::make_unique<ParameterList>(std::move(identifiers), std::make_shared<FuncType>(std::move(P), nullptr, std::move(restricts)));
 }
 
 ExprHandle Parser::parseFnBody(std::shared_ptr<FuncType> const& F, Segment decl) {
     ExprHandle clause;
     TypeReference type0;
+    returns.clear();
     {
         clause = parseExpression();
         if (returns.empty()) {
@@ -380,6 +468,10 @@ void Parser::parseFile() {
     while (remains()) {
         while (remains() && peek().type == TokenType::LINEBREAK) next();
         if (!remains()) return;
+        auto annotations = parseAnnotations();
+        if (!annotations.empty() && peek().type != TokenType::KW_FN && peek().type != TokenType::KW_EXPORT) {
+            raise("annotations are only applicable to functions", annotations.front());
+        }
         bool exported = false;
         if (peek().type == TokenType::KW_EXPORT) {
             next();
@@ -389,16 +481,26 @@ void Parser::parseFile() {
         switch (token.type) {
             case TokenType::KW_FN: {
                 auto fn = parseFn();
+                annotate(fn.get(), annotations);
                 if (exported)
                     context.global->exports.emplace(compiler.of(fn->name->token), fn->parameters->prototype);
                 context.global->fns.push_back(std::move(fn));
                 break;
             }
             case TokenType::KW_LET:
-                if (exported) raise("exported global variable is not yet supported", token);
+                if (!annotations.empty()) raise("annotations are only applicable to functions", annotations.front());
                 context.global->lets.push_back(parseLet(true));
+                if (exported) {
+                    auto& let = context.global->lets.back();
+                    ExportedLet exportedLet{let->getType()};
+                    if (auto array = dynamic_cast<ArrayExpr*>(let->initializer.get())) {
+                        exportedLet.length = array->elements.size();
+                    }
+                    context.global->exportedLets.emplace(compiler.of(let->declarator->name->token), std::move(exportedLet));
+                }
                 break;
             case TokenType::KW_IMPORT:
+                if (!annotations.empty()) raise("annotations are only applicable to functions", annotations.front());
                 next();
                 context.global->import_(
                         parseString(compiler.source, expect(TokenType::STRING_LITERAL, "quoted string")),
@@ -410,6 +512,32 @@ void Parser::parseFile() {
     }
 }
 
+std::vector<Token> Parser::parseAnnotations() {
+    std::vector<Token> annotations;
+    while (remains() && peek().type == TokenType::OP_AT) {
+        next();
+        annotations.push_back(expect(TokenType::IDENTIFIER, "annotation"));
+        while (remains() && peek().type == TokenType::LINEBREAK) next();
+    }
+    return annotations;
+}
+
+void Parser::annotate(FunctionDeclarator* fn, std::vector<Token> const& annotations) {
+    for (auto&& annotation : annotations) {
+        auto name = compiler.of(annotation);
+        if (name == "fast") {
+            if (!fn->definition) raise("@fast is only applicable to function definitions", annotation);
+            fn->definition->fast = true;
+            continue;
+        }
+        auto it = std::find(std::begin(FUNCTION_ATTRIBUTE_NAME), std::end(FUNCTION_ATTRIBUTE_NAME), name);
+        if (it == std::end(FUNCTION_ATTRIBUTE_NAME)) {
+            raise("unknown annotation", annotation);
+        }
+        fn->parameters->prototype->add(FunctionAttribute(it - std::begin(FUNCTION_ATTRIBUTE_NAME)));
+    }
+}
+
 std::unique_ptr<FunctionDeclarator> Parser::parseFn() {
     auto token = next();
     IdExprHandle name = parseId(false);
@@ -422,6 +550,7 @@ std::unique_ptr<FunctionDeclarator> Parser::parseFn() {
         parameters->declare(compiler, context);
         auto clause = parseFnBody(parameters->prototype, range(token, token2));
         auto definition = std::make_unique<FunctionDefinition>(std::move(clause), std::move(context.localTypes));
+        context.localArrays.clear();
         return std::make_unique<FunctionDeclarator>(std::move(name), std::move(parameters), std::move(definition));
     } else {
         if (parameters->prototype->R == nullptr) {
@@ -439,10 +568,17 @@ std::unique_ptr<LetExpr> Parser::parseLet(bool global) {
     auto initializer = parseExpression();
     declarator->infer(initializer->getType(declarator->typeCache));
     if (global) {
-        initializer->requireConst();
+        if (dynamic_cast<ArrayExpr*>(initializer.get())) {
+            context.global->arrays.emplace(compiler.of(declarator->name->token));
+        } else {
+            initializer->requireConst();
+        }
         context.global->declare(compiler, declarator->name->token, initializer->getType());
     } else {
         declarator->declare(context);
+        if (dynamic_cast<ArrayExpr*>(initializer.get())) {
+            context.array(compiler.of(declarator->name->token));
+        }
     }
     return make<LetExpr>(token, std::move(declarator), std::move(initializer));
 }
@@ -468,6 +604,13 @@ TypeReference Parser::parseType() {
             neverGonnaGiveYouUp(E, "to take address", rewind());
             return std::make_shared<PointerType>(E);
         }
+        case TokenType::LBRACKET: {
+            expect(TokenType::RBRACKET, "]");
+            auto E = parseType();
+            neverGonnaGiveYouUp(E, "as an element of slice", rewind());
+            if (isNone(E)) raise("none is not allowed as an element of slice", rewind());
+            return std::make_shared<SliceType>(E);
+        }
         case TokenType::LPAREN: {
             std::vector<TypeReference> P;
             while (true) {
@@ -504,9 +647,18 @@ IdExprHandle Parser::parseId(bool initialize) {
     return id;
 }
 
-std::unique_ptr<SimpleDeclarator> Parser::parseDeclarator() {
+std::unique_ptr<SimpleDeclarator> Parser::parseDeclarator(bool parameter) {
     auto id = parseId(false);
-    auto type = optionalType();
+    bool restricted = false;
+    TypeReference type;
+    if (peek().type == TokenType::OP_COLON) {
+        next();
+        if (parameter && peek().type == TokenType::IDENTIFIER && compiler.of(peek()) == "restrict") {
+            next();
+            restricted = true;
+        }
+        type = parseType();
+    }
     bool underscore = compiler.of(id->token) == "_";
     auto segment = range(id->segment(), rewind());
     if (type == nullptr) {
@@ -520,7 +672,7 @@ std::unique_ptr<SimpleDeclarator> Parser::parseDeclarator() {
                     ).raise();
         }
     }
-    return std::make_unique<SimpleDeclarator>(compiler, segment, std::move(id), std::move(type));
+    return std::make_unique<SimpleDeclarator>(compiler, segment, std::move(id), std::move(type), restricted);
 }
 
 }
\ No newline at end of file
@@ -37,16 +37,19 @@ struct Parser {
     std::vector<ExprHandle> parseExpressions(TokenType stop);
     std::unique_ptr<ClauseExpr> parseClause();
     IdExprHandle parseId(bool initialize);
-    ExprHandle parseIf(), parseWhile();
+    ExprHandle parseBuiltin();
+    ExprHandle parseIf(), parseWhile(), parseMatch();
     std::unique_ptr<FunctionDeclarator> parseFn();
     std::unique_ptr<LetExpr> parseLet(bool global);
     TypeReference parseType();
     ExprHandle parseFnBody(std::shared_ptr<FuncType> const& func, Segment decl);
     void parseFile();
+    std::vector<Token> parseAnnotations();
+    void annotate(FunctionDeclarator* fn, std::vector<Token> const& annotations);
 
     std::unique_ptr<ParameterList> parseParameters();
 
-    std::unique_ptr<SimpleDeclarator> parseDeclarator();
+    std::unique_ptr<SimpleDeclarator> parseDeclarator(bool parameter = false);
 
     Token expect(TokenType type, const char* msg) {
         auto token = next();
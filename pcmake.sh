@@ -4,11 +4,14 @@ interpret=0
 verbose=0
 while [ $OPTIND -le "$#" ]
 do
-    if getopts go:iv option
+    if getopts gbtfo:iv option
     then
         case $option
         in
             g) g="-g";;
+            b) b="-b";;
+            t) t="-t";;
+            f) f="-ffast-math";;
             o) output=${OPTARG};;
             i) interpret=1;;
             v) verbose=1;;
@@ -27,7 +30,7 @@ do
     clang -emit-llvm -S $file $g -o "$((cnt++)).ll"
   elif [[ $file == *.pc ]]
   then
-    ./PorkchopLite $file -o "$((cnt++)).ll" -l $g
+    ./PorkchopLite $file -o "$((cnt++)).ll" -l $g $b $t $f
   fi
 done
 
@@ -0,0 +1,567 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define void @fill(ptr %0, i64 %1, i64 %2) nounwind norecurse {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca i64
+    %7 = load i64, ptr %4
+    %8 = load ptr, ptr %3
+    %9 = getelementptr inbounds i64, ptr %8, i64 0
+    store i64 %7, ptr %9
+    store i64 1, ptr %6
+    br label %L1
+L1:
+    %10 = load i64, ptr %6
+    %11 = load i64, ptr %4
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load i64, ptr %5
+    %14 = load ptr, ptr %3
+    %15 = load i64, ptr %6
+    %16 = getelementptr inbounds i64, ptr %14, i64 %15
+    store i64 %13, ptr %16
+    %17 = load i64, ptr %6
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %6
+    br label %L1
+L3:
+    ret void
+}
+define i64 @damage(ptr %0, i64 %1) readonly nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i64
+    %5 = alloca i64
+    store i64 0, ptr %4
+    store i64 1, ptr %5
+    br label %L1
+L1:
+    %6 = load i64, ptr %5
+    %7 = load ptr, ptr %2
+    %8 = getelementptr inbounds i64, ptr %7, i64 0
+    %9 = load i64, ptr %8
+    %10 = icmp slt i64 %6, %9
+    br i1 %10, label %L2, label %L3
+L2:
+    %11 = load ptr, ptr %2
+    %12 = load i64, ptr %5
+    %13 = getelementptr inbounds i64, ptr %11, i64 %12
+    %14 = load i64, ptr %13
+    %15 = load i64, ptr %3
+    %16 = icmp ne i64 %14, %15
+    br i1 %16, label %L4, label %L5
+L4:
+    %17 = load i64, ptr %4
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %4
+    br label %L6
+L5:
+    br label %L6
+L6:
+    %19 = load i64, ptr %5
+    %20 = add nsw i64 %19, 1
+    store i64 %20, ptr %5
+    br label %L1
+L3:
+    %21 = load i64, ptr %4
+    ret i64 %21
+}
+define i64 @length_of(i64 %0) readnone nounwind willreturn norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca i64
+    %3 = load i64, ptr %1
+    %4 = srem i64 %3, 4096
+    %5 = icmp eq i64 %4, 0
+    br i1 %5, label %L1, label %L2
+L1:
+    store i64 600, ptr %2
+    br label %L3
+L2:
+    %6 = load i64, ptr %1
+    %7 = srem i64 %6, 30
+    %8 = add nsw i64 2, %7
+    store i64 %8, ptr %2
+    br label %L3
+L3:
+    %9 = load i64, ptr %2
+    ret i64 %9
+}
+define ptr @churn(ptr %0) nounwind norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca ptr
+    %5 = alloca i64
+    %6 = alloca i64
+    %7 = alloca i64
+    %8 = alloca i64
+    %9 = alloca i64
+    %10 = load ptr, ptr %1
+    %11 = ptrtoint ptr %10 to i64
+    store i64 %11, ptr %2
+    store i64 64, ptr %3
+    %12 = load i64, ptr %3
+    %13 = mul nsw i64 8, %12
+    %14 = call ptr @alloc(i64 %13)
+    store ptr %14, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %15 = load i64, ptr %5
+    %16 = load i64, ptr %3
+    %17 = icmp slt i64 %15, %16
+    br i1 %17, label %L2, label %L3
+L2:
+    %18 = mul nsw i64 8, 2
+    %19 = call ptr @alloc(i64 %18)
+    %20 = load ptr, ptr %4
+    %21 = load i64, ptr %5
+    %22 = getelementptr inbounds ptr, ptr %20, i64 %21
+    store ptr %19, ptr %22
+    %23 = load ptr, ptr %4
+    %24 = load i64, ptr %5
+    %25 = getelementptr inbounds ptr, ptr %23, i64 %24
+    %26 = load ptr, ptr %25
+    %27 = load i64, ptr %5
+    call void @fill(ptr %26, i64 2, i64 %27)
+    %28 = load i64, ptr %5
+    %29 = add nsw i64 %28, 1
+    store i64 %29, ptr %5
+    br label %L1
+L3:
+    store i64 0, ptr %6
+    store i64 0, ptr %7
+    store i64 0, ptr %8
+    store i64 0, ptr %9
+    store i64 0, ptr %5
+    br label %L4
+L4:
+    %30 = load i64, ptr %5
+    %31 = load i64, ptr %2
+    %32 = icmp slt i64 %30, %31
+    br i1 %32, label %L5, label %L6
+L5:
+    %33 = load i64, ptr %5
+    %34 = load i64, ptr %3
+    %35 = srem i64 %33, %34
+    store i64 %35, ptr %8
+    %36 = load i64, ptr %6
+    %37 = load ptr, ptr %4
+    %38 = load i64, ptr %8
+    %39 = getelementptr inbounds ptr, ptr %37, i64 %38
+    %40 = load ptr, ptr %39
+    %41 = getelementptr inbounds i64, ptr %40, i64 1
+    %42 = load i64, ptr %41
+    %43 = add nsw i64 %36, %42
+    store i64 %43, ptr %6
+    %44 = load i64, ptr %7
+    %45 = load ptr, ptr %4
+    %46 = load i64, ptr %8
+    %47 = getelementptr inbounds ptr, ptr %45, i64 %46
+    %48 = load ptr, ptr %47
+    %49 = load ptr, ptr %4
+    %50 = load i64, ptr %8
+    %51 = getelementptr inbounds ptr, ptr %49, i64 %50
+    %52 = load ptr, ptr %51
+    %53 = getelementptr inbounds i64, ptr %52, i64 1
+    %54 = load i64, ptr %53
+    %55 = call i64 @damage(ptr %48, i64 %54)
+    %56 = add nsw i64 %44, %55
+    store i64 %56, ptr %7
+    %57 = load ptr, ptr %4
+    %58 = load i64, ptr %8
+    %59 = getelementptr inbounds ptr, ptr %57, i64 %58
+    %60 = load ptr, ptr %59
+    call void @dealloc(ptr %60)
+    %61 = load i64, ptr %5
+    %62 = call i64 @length_of(i64 %61)
+    store i64 %62, ptr %9
+    %63 = load i64, ptr %9
+    %64 = mul nsw i64 8, %63
+    %65 = call ptr @alloc(i64 %64)
+    %66 = load ptr, ptr %4
+    %67 = load i64, ptr %8
+    %68 = getelementptr inbounds ptr, ptr %66, i64 %67
+    store ptr %65, ptr %68
+    %69 = load ptr, ptr %4
+    %70 = load i64, ptr %8
+    %71 = getelementptr inbounds ptr, ptr %69, i64 %70
+    %72 = load ptr, ptr %71
+    %73 = load i64, ptr %9
+    %74 = load i64, ptr %5
+    call void @fill(ptr %72, i64 %73, i64 %74)
+    %75 = load i64, ptr %5
+    %76 = add nsw i64 %75, 1
+    store i64 %76, ptr %5
+    br label %L4
+L6:
+    store i64 0, ptr %5
+    br label %L7
+L7:
+    %77 = load i64, ptr %5
+    %78 = load i64, ptr %3
+    %79 = icmp slt i64 %77, %78
+    br i1 %79, label %L8, label %L9
+L8:
+    %80 = load i64, ptr %7
+    %81 = load ptr, ptr %4
+    %82 = load i64, ptr %5
+    %83 = getelementptr inbounds ptr, ptr %81, i64 %82
+    %84 = load ptr, ptr %83
+    %85 = load ptr, ptr %4
+    %86 = load i64, ptr %5
+    %87 = getelementptr inbounds ptr, ptr %85, i64 %86
+    %88 = load ptr, ptr %87
+    %89 = getelementptr inbounds i64, ptr %88, i64 1
+    %90 = load i64, ptr %89
+    %91 = call i64 @damage(ptr %84, i64 %90)
+    %92 = add nsw i64 %80, %91
+    store i64 %92, ptr %7
+    %93 = load ptr, ptr %4
+    %94 = load i64, ptr %5
+    %95 = getelementptr inbounds ptr, ptr %93, i64 %94
+    %96 = load ptr, ptr %95
+    call void @dealloc(ptr %96)
+    %97 = load i64, ptr %5
+    %98 = add nsw i64 %97, 1
+    store i64 %98, ptr %5
+    br label %L7
+L9:
+    %99 = load ptr, ptr %4
+    call void @dealloc(ptr %99)
+    %100 = alloca i64
+    %101 = load i64, ptr %7
+    %102 = icmp eq i64 %101, 0
+    br i1 %102, label %L10, label %L11
+L10:
+    %103 = load i64, ptr %6
+    store i64 %103, ptr %100
+    br label %L12
+L11:
+    store i64 -1, ptr %100
+    br label %L12
+L12:
+    %104 = load i64, ptr %100
+    %105 = inttoptr i64 %104 to ptr
+    ret ptr %105
+}
+define ptr @release(ptr %0) nounwind norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca ptr
+    %4 = alloca i64
+    %5 = alloca i64
+    %6 = load ptr, ptr %1
+    store ptr %6, ptr %2
+    %7 = load ptr, ptr %2
+    %8 = getelementptr inbounds i64, ptr %7, i64 0
+    %9 = load i64, ptr %8
+    %10 = inttoptr i64 %9 to ptr
+    store ptr %10, ptr %3
+    store i64 0, ptr %4
+    %11 = load ptr, ptr %2
+    %12 = getelementptr inbounds i64, ptr %11, i64 1
+    %13 = load i64, ptr %12
+    store i64 %13, ptr %5
+    br label %L1
+L1:
+    %14 = load i64, ptr %5
+    %15 = load ptr, ptr %2
+    %16 = getelementptr inbounds i64, ptr %15, i64 2
+    %17 = load i64, ptr %16
+    %18 = icmp slt i64 %14, %17
+    br i1 %18, label %L2, label %L3
+L2:
+    %19 = load i64, ptr %4
+    %20 = load ptr, ptr %3
+    %21 = load i64, ptr %5
+    %22 = getelementptr inbounds ptr, ptr %20, i64 %21
+    %23 = load ptr, ptr %22
+    %24 = load i64, ptr %5
+    %25 = call i64 @damage(ptr %23, i64 %24)
+    %26 = add nsw i64 %19, %25
+    store i64 %26, ptr %4
+    %27 = load ptr, ptr %3
+    %28 = load i64, ptr %5
+    %29 = getelementptr inbounds ptr, ptr %27, i64 %28
+    %30 = load ptr, ptr %29
+    call void @dealloc(ptr %30)
+    %31 = load i64, ptr %5
+    %32 = add nsw i64 %31, 1
+    store i64 %32, ptr %5
+    br label %L1
+L3:
+    %33 = load i64, ptr %4
+    %34 = inttoptr i64 %33 to ptr
+    ret ptr %34
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca i64
+    %2 = alloca ptr
+    %3 = alloca double
+    %4 = alloca i64
+    %5 = alloca i64
+    %6 = alloca i64
+    %7 = alloca ptr
+    %8 = alloca ptr
+    %9 = alloca i64
+    store i64 4, ptr %0
+    store i64 1000000, ptr %1
+    %10 = load i64, ptr %0
+    %11 = mul nsw i64 8, %10
+    %12 = call ptr @alloc(i64 %11)
+    store ptr %12, ptr %2
+    %13 = call double @pc_time()
+    %14 = fneg double %13
+    store double %14, ptr %3
+    store i64 0, ptr %4
+    br label %L1
+L1:
+    %15 = load i64, ptr %4
+    %16 = load i64, ptr %0
+    %17 = icmp slt i64 %15, %16
+    br i1 %17, label %L2, label %L3
+L2:
+    %18 = load i64, ptr %1
+    %19 = inttoptr i64 %18 to ptr
+    %20 = call i64 @thread_create(ptr @churn, ptr %19)
+    %21 = load ptr, ptr %2
+    %22 = load i64, ptr %4
+    %23 = getelementptr inbounds i64, ptr %21, i64 %22
+    store i64 %20, ptr %23
+    %24 = load i64, ptr %4
+    %25 = add nsw i64 %24, 1
+    store i64 %25, ptr %4
+    br label %L1
+L3:
+    store i64 0, ptr %5
+    store i64 0, ptr %4
+    br label %L4
+L4:
+    %26 = load i64, ptr %4
+    %27 = load i64, ptr %0
+    %28 = icmp slt i64 %26, %27
+    br i1 %28, label %L5, label %L6
+L5:
+    %29 = load i64, ptr %5
+    %30 = load ptr, ptr %2
+    %31 = load i64, ptr %4
+    %32 = getelementptr inbounds i64, ptr %30, i64 %31
+    %33 = load i64, ptr %32
+    %34 = call ptr @thread_join(i64 %33)
+    %35 = ptrtoint ptr %34 to i64
+    %36 = add nsw i64 %29, %35
+    store i64 %36, ptr %5
+    %37 = load i64, ptr %4
+    %38 = add nsw i64 %37, 1
+    store i64 %38, ptr %4
+    br label %L4
+L6:
+    %39 = load double, ptr %3
+    %40 = call double @pc_time()
+    %41 = fadd double %39, %40
+    store double %41, ptr %3
+    %42 = load i64, ptr %5
+    call void @printint(i64 %42)
+    %43 = load double, ptr %3
+    %44 = fmul double %43, 1000.000000
+    call void @printfloat(double %44)
+    store i64 16384, ptr %6
+    %45 = load i64, ptr %6
+    %46 = mul nsw i64 8, %45
+    %47 = call ptr @alloc(i64 %46)
+    store ptr %47, ptr %7
+    store i64 0, ptr %4
+    br label %L7
+L7:
+    %48 = load i64, ptr %4
+    %49 = load i64, ptr %6
+    %50 = icmp slt i64 %48, %49
+    br i1 %50, label %L8, label %L9
+L8:
+    %51 = load i64, ptr %4
+    %52 = call i64 @length_of(i64 %51)
+    %53 = mul nsw i64 8, %52
+    %54 = call ptr @alloc(i64 %53)
+    %55 = load ptr, ptr %7
+    %56 = load i64, ptr %4
+    %57 = getelementptr inbounds ptr, ptr %55, i64 %56
+    store ptr %54, ptr %57
+    %58 = load ptr, ptr %7
+    %59 = load i64, ptr %4
+    %60 = getelementptr inbounds ptr, ptr %58, i64 %59
+    %61 = load ptr, ptr %60
+    %62 = load i64, ptr %4
+    %63 = call i64 @length_of(i64 %62)
+    %64 = load i64, ptr %4
+    call void @fill(ptr %61, i64 %63, i64 %64)
+    %65 = load i64, ptr %4
+    %66 = add nsw i64 %65, 1
+    store i64 %66, ptr %4
+    br label %L7
+L9:
+    %67 = load i64, ptr %0
+    %68 = mul nsw i64 8, %67
+    %69 = mul nsw i64 %68, 3
+    %70 = call ptr @alloc(i64 %69)
+    store ptr %70, ptr %8
+    store i64 0, ptr %4
+    br label %L10
+L10:
+    %71 = load i64, ptr %4
+    %72 = load i64, ptr %0
+    %73 = icmp slt i64 %71, %72
+    br i1 %73, label %L11, label %L12
+L11:
+    %74 = load ptr, ptr %7
+    %75 = ptrtoint ptr %74 to i64
+    %76 = load ptr, ptr %8
+    %77 = load i64, ptr %4
+    %78 = mul nsw i64 %77, 3
+    %79 = getelementptr inbounds i64, ptr %76, i64 %78
+    store i64 %75, ptr %79
+    %80 = load i64, ptr %4
+    %81 = load i64, ptr %6
+    %82 = mul nsw i64 %80, %81
+    %83 = load i64, ptr %0
+    %84 = sdiv i64 %82, %83
+    %85 = load ptr, ptr %8
+    %86 = load i64, ptr %4
+    %87 = mul nsw i64 %86, 3
+    %88 = add nsw i64 %87, 1
+    %89 = getelementptr inbounds i64, ptr %85, i64 %88
+    store i64 %84, ptr %89
+    %90 = load i64, ptr %4
+    %91 = add nsw i64 %90, 1
+    %92 = load i64, ptr %6
+    %93 = mul nsw i64 %91, %92
+    %94 = load i64, ptr %0
+    %95 = sdiv i64 %93, %94
+    %96 = load ptr, ptr %8
+    %97 = load i64, ptr %4
+    %98 = mul nsw i64 %97, 3
+    %99 = add nsw i64 %98, 2
+    %100 = getelementptr inbounds i64, ptr %96, i64 %99
+    store i64 %95, ptr %100
+    %101 = load ptr, ptr %8
+    %102 = load i64, ptr %4
+    %103 = mul nsw i64 %102, 3
+    %104 = getelementptr inbounds i64, ptr %101, i64 %103
+    %105 = call i64 @thread_create(ptr @release, ptr %104)
+    %106 = load ptr, ptr %2
+    %107 = load i64, ptr %4
+    %108 = getelementptr inbounds i64, ptr %106, i64 %107
+    store i64 %105, ptr %108
+    %109 = load i64, ptr %4
+    %110 = add nsw i64 %109, 1
+    store i64 %110, ptr %4
+    br label %L10
+L12:
+    store i64 0, ptr %9
+    store i64 0, ptr %4
+    br label %L13
+L13:
+    %111 = load i64, ptr %4
+    %112 = load i64, ptr %0
+    %113 = icmp slt i64 %111, %112
+    br i1 %113, label %L14, label %L15
+L14:
+    %114 = load i64, ptr %9
+    %115 = load ptr, ptr %2
+    %116 = load i64, ptr %4
+    %117 = getelementptr inbounds i64, ptr %115, i64 %116
+    %118 = load i64, ptr %117
+    %119 = call ptr @thread_join(i64 %118)
+    %120 = ptrtoint ptr %119 to i64
+    %121 = add nsw i64 %114, %120
+    store i64 %121, ptr %9
+    %122 = load i64, ptr %4
+    %123 = add nsw i64 %122, 1
+    store i64 %123, ptr %4
+    br label %L13
+L15:
+    %124 = load i64, ptr %9
+    call void @printint(i64 %124)
+    %125 = load ptr, ptr %8
+    call void @dealloc(ptr %125)
+    %126 = load ptr, ptr %7
+    call void @dealloc(ptr %126)
+    %127 = load ptr, ptr %2
+    call void @dealloc(ptr %127)
+    call void @alloc_stats()
+    ret i64 0
+}
@@ -0,0 +1,345 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @phase_malloc(i64 %0) nounwind norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca ptr
+    %5 = alloca i64
+    %6 = alloca ptr
+    %7 = mul nsw i64 8, 2
+    %8 = call ptr @alloc(i64 %7)
+    store ptr %8, ptr %2
+    %9 = load ptr, ptr %2
+    %10 = getelementptr inbounds i64, ptr %9, i64 0
+    store i64 0, ptr %10
+    %11 = load ptr, ptr %2
+    %12 = getelementptr inbounds i64, ptr %11, i64 1
+    store i64 0, ptr %12
+    store i64 1, ptr %3
+    br label %L1
+L1:
+    %13 = load i64, ptr %3
+    %14 = load i64, ptr %1
+    %15 = icmp slt i64 %13, %14
+    br i1 %15, label %L2, label %L3
+L2:
+    %16 = mul nsw i64 8, 2
+    %17 = call ptr @alloc(i64 %16)
+    store ptr %17, ptr %4
+    %18 = load i64, ptr %3
+    %19 = load ptr, ptr %4
+    %20 = getelementptr inbounds i64, ptr %19, i64 0
+    store i64 %18, ptr %20
+    %21 = load ptr, ptr %2
+    %22 = ptrtoint ptr %21 to i64
+    %23 = load ptr, ptr %4
+    %24 = getelementptr inbounds i64, ptr %23, i64 1
+    store i64 %22, ptr %24
+    %25 = load ptr, ptr %4
+    store ptr %25, ptr %2
+    %26 = load i64, ptr %3
+    %27 = add nsw i64 %26, 1
+    store i64 %27, ptr %3
+    br label %L1
+L3:
+    store i64 0, ptr %5
+    br label %L4
+L4:
+    %28 = load ptr, ptr %2
+    %29 = ptrtoint ptr %28 to i64
+    %30 = icmp ne i64 %29, 0
+    br i1 %30, label %L5, label %L6
+L5:
+    %31 = load i64, ptr %5
+    %32 = load ptr, ptr %2
+    %33 = getelementptr inbounds i64, ptr %32, i64 0
+    %34 = load i64, ptr %33
+    %35 = add nsw i64 %31, %34
+    store i64 %35, ptr %5
+    %36 = load ptr, ptr %2
+    %37 = getelementptr inbounds i64, ptr %36, i64 1
+    %38 = load i64, ptr %37
+    %39 = inttoptr i64 %38 to ptr
+    store ptr %39, ptr %6
+    %40 = load ptr, ptr %2
+    call void @dealloc(ptr %40)
+    %41 = load ptr, ptr %6
+    store ptr %41, ptr %2
+    br label %L4
+L6:
+    %42 = load i64, ptr %5
+    ret i64 %42
+}
+define i64 @phase_arena(ptr %0, i64 %1) nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca ptr
+    %5 = alloca i64
+    %6 = alloca ptr
+    %7 = alloca i64
+    %8 = load ptr, ptr %2
+    %9 = mul nsw i64 8, 2
+    %10 = call ptr @arena_alloc(ptr %8, i64 %9, i64 8)
+    store ptr %10, ptr %4
+    %11 = load ptr, ptr %4
+    %12 = getelementptr inbounds i64, ptr %11, i64 0
+    store i64 0, ptr %12
+    %13 = load ptr, ptr %4
+    %14 = getelementptr inbounds i64, ptr %13, i64 1
+    store i64 0, ptr %14
+    store i64 1, ptr %5
+    br label %L1
+L1:
+    %15 = load i64, ptr %5
+    %16 = load i64, ptr %3
+    %17 = icmp slt i64 %15, %16
+    br i1 %17, label %L2, label %L3
+L2:
+    %18 = load ptr, ptr %2
+    %19 = mul nsw i64 8, 2
+    %20 = call ptr @arena_alloc(ptr %18, i64 %19, i64 8)
+    store ptr %20, ptr %6
+    %21 = load i64, ptr %5
+    %22 = load ptr, ptr %6
+    %23 = getelementptr inbounds i64, ptr %22, i64 0
+    store i64 %21, ptr %23
+    %24 = load ptr, ptr %4
+    %25 = ptrtoint ptr %24 to i64
+    %26 = load ptr, ptr %6
+    %27 = getelementptr inbounds i64, ptr %26, i64 1
+    store i64 %25, ptr %27
+    %28 = load ptr, ptr %6
+    store ptr %28, ptr %4
+    %29 = load i64, ptr %5
+    %30 = add nsw i64 %29, 1
+    store i64 %30, ptr %5
+    br label %L1
+L3:
+    store i64 0, ptr %7
+    br label %L4
+L4:
+    %31 = load ptr, ptr %4
+    %32 = ptrtoint ptr %31 to i64
+    %33 = icmp ne i64 %32, 0
+    br i1 %33, label %L5, label %L6
+L5:
+    %34 = load i64, ptr %7
+    %35 = load ptr, ptr %4
+    %36 = getelementptr inbounds i64, ptr %35, i64 0
+    %37 = load i64, ptr %36
+    %38 = add nsw i64 %34, %37
+    store i64 %38, ptr %7
+    %39 = load ptr, ptr %4
+    %40 = getelementptr inbounds i64, ptr %39, i64 1
+    %41 = load i64, ptr %40
+    %42 = inttoptr i64 %41 to ptr
+    store ptr %42, ptr %4
+    br label %L4
+L6:
+    %43 = load ptr, ptr %2
+    call void @arena_reset(ptr %43)
+    %44 = load i64, ptr %7
+    ret i64 %44
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca i64
+    %1 = alloca i64
+    %2 = alloca i64
+    %3 = alloca double
+    %4 = alloca i64
+    %5 = alloca ptr
+    %6 = alloca ptr
+    %7 = alloca ptr
+    store i64 100, ptr %0
+    store i64 100000, ptr %1
+    store i64 0, ptr %2
+    %8 = call double @pc_time()
+    %9 = fneg double %8
+    store double %9, ptr %3
+    store i64 0, ptr %4
+    br label %L1
+L1:
+    %10 = load i64, ptr %4
+    %11 = load i64, ptr %0
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load i64, ptr %2
+    %14 = load i64, ptr %1
+    %15 = call i64 @phase_malloc(i64 %14)
+    %16 = add nsw i64 %13, %15
+    store i64 %16, ptr %2
+    %17 = load i64, ptr %4
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %4
+    br label %L1
+L3:
+    %19 = load double, ptr %3
+    %20 = call double @pc_time()
+    %21 = fadd double %19, %20
+    store double %21, ptr %3
+    %22 = load i64, ptr %2
+    call void @printint(i64 %22)
+    %23 = load double, ptr %3
+    %24 = fmul double %23, 1000.000000
+    call void @printfloat(double %24)
+    %25 = call ptr @arena_create(i64 4096)
+    store ptr %25, ptr %5
+    store i64 0, ptr %2
+    %26 = call double @pc_time()
+    %27 = fneg double %26
+    store double %27, ptr %3
+    store i64 0, ptr %4
+    br label %L4
+L4:
+    %28 = load i64, ptr %4
+    %29 = load i64, ptr %0
+    %30 = icmp slt i64 %28, %29
+    br i1 %30, label %L5, label %L6
+L5:
+    %31 = load i64, ptr %2
+    %32 = load ptr, ptr %5
+    %33 = load i64, ptr %1
+    %34 = call i64 @phase_arena(ptr %32, i64 %33)
+    %35 = add nsw i64 %31, %34
+    store i64 %35, ptr %2
+    %36 = load i64, ptr %4
+    %37 = add nsw i64 %36, 1
+    store i64 %37, ptr %4
+    br label %L4
+L6:
+    %38 = load double, ptr %3
+    %39 = call double @pc_time()
+    %40 = fadd double %38, %39
+    store double %40, ptr %3
+    %41 = load ptr, ptr %5
+    call void @arena_destroy(ptr %41)
+    %42 = load i64, ptr %2
+    call void @printint(i64 %42)
+    %43 = load double, ptr %3
+    %44 = fmul double %43, 1000.000000
+    call void @printfloat(double %44)
+    store i64 0, ptr %2
+    %45 = call double @pc_time()
+    %46 = fneg double %45
+    store double %46, ptr %3
+    store i64 0, ptr %4
+    br label %L7
+L7:
+    %47 = load i64, ptr %4
+    %48 = load i64, ptr %0
+    %49 = icmp slt i64 %47, %48
+    br i1 %49, label %L8, label %L9
+L8:
+    %50 = load i64, ptr %2
+    %51 = call ptr @arena_local()
+    %52 = load i64, ptr %1
+    %53 = call i64 @phase_arena(ptr %51, i64 %52)
+    %54 = add nsw i64 %50, %53
+    store i64 %54, ptr %2
+    %55 = load i64, ptr %4
+    %56 = add nsw i64 %55, 1
+    store i64 %56, ptr %4
+    br label %L7
+L9:
+    %57 = load double, ptr %3
+    %58 = call double @pc_time()
+    %59 = fadd double %57, %58
+    store double %59, ptr %3
+    %60 = load i64, ptr %2
+    call void @printint(i64 %60)
+    %61 = load double, ptr %3
+    %62 = fmul double %61, 1000.000000
+    call void @printfloat(double %62)
+    %63 = call ptr @arena_local()
+    %64 = call ptr @arena_alloc(ptr %63, i64 1, i64 1)
+    store ptr %64, ptr %6
+    %65 = call ptr @arena_local()
+    %66 = call ptr @arena_alloc(ptr %65, i64 8, i64 256)
+    store ptr %66, ptr %7
+    %67 = load ptr, ptr %7
+    %68 = ptrtoint ptr %67 to i64
+    %69 = srem i64 %68, 256
+    call void @printint(i64 %69)
+    %70 = alloca i64
+    %71 = load ptr, ptr %7
+    %72 = ptrtoint ptr %71 to i64
+    %73 = load ptr, ptr %6
+    %74 = ptrtoint ptr %73 to i64
+    %75 = icmp sgt i64 %72, %74
+    br i1 %75, label %L10, label %L11
+L10:
+    store i64 1, ptr %70
+    br label %L12
+L11:
+    store i64 0, ptr %70
+    br label %L12
+L12:
+    %76 = load i64, ptr %70
+    call void @printint(i64 %76)
+    ret i64 0
+}
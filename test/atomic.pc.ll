@@ -0,0 +1,264 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define ptr @count(ptr %0, i64 %1, i64 %2) nounwind norecurse {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca ptr
+    %7 = alloca i64
+    %8 = load ptr, ptr %3
+    store ptr %8, ptr %6
+    store i64 0, ptr %7
+    br label %L1
+L1:
+    %9 = load i64, ptr %7
+    %10 = load i64, ptr %5
+    %11 = icmp slt i64 %9, %10
+    br i1 %11, label %L2, label %L3
+L2:
+    %12 = load ptr, ptr %6
+    %13 = load i64, ptr %4
+    %14 = load i64, ptr %7
+    %15 = add nsw i64 %13, %14
+    %16 = atomicrmw add ptr %12, i64 %15 seq_cst, align 8
+    %17 = load ptr, ptr %6
+    %18 = getelementptr inbounds i64, ptr %17, i64 1
+    %19 = load i64, ptr %4
+    %20 = load i64, ptr %7
+    %21 = add nsw i64 %19, %20
+    %22 = atomicrmw max ptr %18, i64 %21 monotonic, align 8
+    %23 = load i64, ptr %7
+    %24 = add nsw i64 %23, 1
+    store i64 %24, ptr %7
+    br label %L1
+L3:
+    %25 = load ptr, ptr %3
+    ret ptr %25
+}
+define ptr @spin(ptr %0) nounwind norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = load ptr, ptr %1
+    store ptr %4, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %5 = load i64, ptr %3
+    %6 = icmp slt i64 %5, 10000
+    br i1 %6, label %L2, label %L3
+L2:
+    br label %L4
+L4:
+    %7 = load ptr, ptr %2
+    %8 = getelementptr inbounds i64, ptr %7, i64 2
+    %9 = cmpxchg ptr %8, i64 0, i64 1 acquire acquire, align 8
+    %10 = extractvalue { i64, i1 } %9, 0
+    %11 = icmp ne i64 %10, 0
+    br i1 %11, label %L5, label %L6
+L5:
+    br label %L4
+L6:
+    %12 = load ptr, ptr %2
+    %13 = getelementptr inbounds i64, ptr %12, i64 3
+    %14 = load i64, ptr %13
+    %15 = add nsw i64 %14, 1
+    %16 = load ptr, ptr %2
+    %17 = getelementptr inbounds i64, ptr %16, i64 3
+    store i64 %15, ptr %17
+    %18 = load ptr, ptr %2
+    %19 = getelementptr inbounds i64, ptr %18, i64 2
+    store atomic i64 0, ptr %19 release, align 8
+    %20 = load i64, ptr %3
+    %21 = add nsw i64 %20, 1
+    store i64 %21, ptr %3
+    br label %L1
+L3:
+    %22 = load ptr, ptr %1
+    ret ptr %22
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca ptr
+    %1 = alloca i64
+    %2 = alloca ptr
+    %3 = alloca ptr
+    %4 = alloca ptr
+    %5 = alloca ptr
+    %6 = mul nsw i64 8, 4
+    %7 = call ptr @alloc(i64 %6)
+    store ptr %7, ptr %0
+    store i64 0, ptr %1
+    br label %L1
+L1:
+    %8 = load i64, ptr %1
+    %9 = icmp slt i64 %8, 4
+    br i1 %9, label %L2, label %L3
+L2:
+    %10 = load ptr, ptr %0
+    %11 = load i64, ptr %1
+    %12 = getelementptr inbounds i64, ptr %10, i64 %11
+    store i64 0, ptr %12
+    %13 = load i64, ptr %1
+    %14 = add nsw i64 %13, 1
+    store i64 %14, ptr %1
+    br label %L1
+L3:
+    %15 = load ptr, ptr %0
+    %16 = call ptr @parallel_for(ptr %15, i64 100000, ptr @count)
+    store ptr %16, ptr %2
+    %17 = load ptr, ptr %2
+    %18 = sub i64 0, 1
+    %19 = getelementptr inbounds i64, ptr %17, i64 %18
+    call void @dealloc(ptr %19)
+    %20 = mul nsw i64 8, 4
+    %21 = call ptr @alloc(i64 %20)
+    store ptr %21, ptr %3
+    store i64 0, ptr %1
+    br label %L4
+L4:
+    %22 = load i64, ptr %1
+    %23 = icmp slt i64 %22, 4
+    br i1 %23, label %L5, label %L6
+L5:
+    %24 = load ptr, ptr %0
+    %25 = call i64 @thread_create(ptr @spin, ptr %24)
+    %26 = load ptr, ptr %3
+    %27 = load i64, ptr %1
+    %28 = getelementptr inbounds i64, ptr %26, i64 %27
+    store i64 %25, ptr %28
+    %29 = load i64, ptr %1
+    %30 = add nsw i64 %29, 1
+    store i64 %30, ptr %1
+    br label %L4
+L6:
+    store i64 0, ptr %1
+    br label %L7
+L7:
+    %31 = load i64, ptr %1
+    %32 = icmp slt i64 %31, 4
+    br i1 %32, label %L8, label %L9
+L8:
+    %33 = load ptr, ptr %3
+    %34 = load i64, ptr %1
+    %35 = getelementptr inbounds i64, ptr %33, i64 %34
+    %36 = load i64, ptr %35
+    %37 = call ptr @thread_join(i64 %36)
+    %38 = load i64, ptr %1
+    %39 = add nsw i64 %38, 1
+    store i64 %39, ptr %1
+    br label %L7
+L9:
+    fence seq_cst
+    %40 = load ptr, ptr %0
+    %41 = load atomic i64, ptr %40 acquire, align 8
+    call void @printint(i64 %41)
+    %42 = load ptr, ptr %0
+    %43 = getelementptr inbounds i64, ptr %42, i64 1
+    %44 = load atomic i64, ptr %43 monotonic, align 8
+    call void @printint(i64 %44)
+    %45 = load ptr, ptr %0
+    %46 = getelementptr inbounds i64, ptr %45, i64 3
+    %47 = load i64, ptr %46
+    call void @printint(i64 %47)
+    %48 = call ptr @alloc(i64 1)
+    store ptr %48, ptr %4
+    %49 = load ptr, ptr %4
+    store i8 0, ptr %49
+    %50 = load ptr, ptr %4
+    %51 = atomicrmw or ptr %50, i8 5 seq_cst, align 1
+    %52 = load ptr, ptr %4
+    %53 = atomicrmw and ptr %52, i8 6 acq_rel, align 1
+    %54 = load ptr, ptr %4
+    %55 = atomicrmw xchg ptr %54, i8 200 seq_cst, align 1
+    %56 = zext i8 %55 to i64
+    call void @printuint(i64 %56)
+    %57 = load ptr, ptr %4
+    %58 = load atomic i8, ptr %57 seq_cst, align 1
+    %59 = zext i8 %58 to i64
+    call void @printuint(i64 %59)
+    %60 = call ptr @alloc(i64 8)
+    store ptr %60, ptr %5
+    %61 = load ptr, ptr %5
+    store atomic double 1.500000, ptr %61 monotonic, align 8
+    %62 = load ptr, ptr %5
+    %63 = atomicrmw fadd ptr %62, double 2.250000 seq_cst, align 8
+    %64 = load ptr, ptr %5
+    %65 = atomicrmw fsub ptr %64, double 0.500000 seq_cst, align 8
+    call void @printfloat(double %65)
+    %66 = load ptr, ptr %5
+    %67 = load double, ptr %66
+    call void @printfloat(double %67)
+    %68 = load ptr, ptr %5
+    call void @dealloc(ptr %68)
+    %69 = load ptr, ptr %4
+    call void @dealloc(ptr %69)
+    %70 = load ptr, ptr %3
+    call void @dealloc(ptr %70)
+    %71 = load ptr, ptr %0
+    call void @dealloc(ptr %71)
+    ret i64 0
+}
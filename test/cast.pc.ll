@@ -1,16 +1,63 @@
-declare void @printint(i64 %0)
-declare void @printfloat(double %0)
-declare void @print_int_array(ptr %0, i64 %1)
-declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4)
-declare ptr @alloc(i64 %0)
-declare void @dealloc(ptr %0)
-declare ptr @parallel_for(ptr %0, i64 %1, ptr %2)
-declare i64 @thread_create(ptr %0, ptr %1)
-declare ptr @thread_join(i64 %0)
-declare i64 @thread_self()
-declare double @pc_time()
-declare void @exit(i64 %0)
-define i64 @main() {
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @main() nounwind willreturn norecurse {
 L0:
     %0 = alloca double
     %1 = alloca i64
@@ -33,7 +80,7 @@ L0:
     call void @printfloat(double %12)
     %13 = ptrtoint ptr %1 to i64
     %14 = ptrtoint ptr %2 to i64
-    %15 = sub i64 %13, %14
+    %15 = sub nsw i64 %13, %14
     call void @printint(i64 %15)
     %16 = load i64, ptr %2
     call void @printint(i64 %16)
@@ -41,14 +88,14 @@ L0:
     %18 = inttoptr i64 %17 to ptr
     %19 = load i64, ptr %18
     call void @printint(i64 %19)
-    %20 = mul i64 8, 10
+    %20 = mul nsw i64 8, 10
     %21 = call ptr @alloc(i64 %20)
     store ptr %21, ptr %3
     %22 = load ptr, ptr %3
-    %23 = getelementptr inbounds ptr, ptr %22, i64 3
+    %23 = getelementptr inbounds i64, ptr %22, i64 3
     store ptr %23, ptr %4
     %24 = load ptr, ptr %3
-    %25 = getelementptr inbounds ptr, ptr %24, i64 8
+    %25 = getelementptr inbounds i64, ptr %24, i64 8
     store ptr %25, ptr %5
     %26 = load ptr, ptr %4
     %27 = load ptr, ptr %5
@@ -0,0 +1,347 @@
+@n = global i64 100000
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define ptr @produce(ptr %0) nounwind {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = call ptr @alloc(i64 8)
+    store ptr %4, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %5 = load i64, ptr %3
+    %6 = load i64, ptr @n
+    %7 = icmp slt i64 %5, %6
+    br i1 %7, label %L2, label %L3
+L2:
+    %8 = load i64, ptr %3
+    %9 = load ptr, ptr %2
+    %10 = getelementptr inbounds i64, ptr %9, i64 0
+    store i64 %8, ptr %10
+    %11 = load ptr, ptr %1
+    %12 = load ptr, ptr %2
+    %13 = call i1 @chan_send(ptr %11, ptr %12)
+    %14 = load i64, ptr %3
+    %15 = add nsw i64 %14, 1
+    store i64 %15, ptr %3
+    br label %L1
+L3:
+    %16 = load ptr, ptr %2
+    call void @dealloc(ptr %16)
+    %17 = load ptr, ptr %1
+    ret ptr %17
+}
+define ptr @square(ptr %0) nounwind {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca ptr
+    %4 = load ptr, ptr %1
+    store ptr %4, ptr %2
+    %5 = call ptr @alloc(i64 8)
+    store ptr %5, ptr %3
+    br label %L1
+L1:
+    %6 = load ptr, ptr %2
+    %7 = getelementptr inbounds ptr, ptr %6, i64 0
+    %8 = load ptr, ptr %7
+    %9 = load ptr, ptr %3
+    %10 = call i1 @chan_recv(ptr %8, ptr %9)
+    br i1 %10, label %L2, label %L3
+L2:
+    %11 = load ptr, ptr %3
+    %12 = getelementptr inbounds i64, ptr %11, i64 0
+    %13 = load i64, ptr %12
+    %14 = load ptr, ptr %3
+    %15 = getelementptr inbounds i64, ptr %14, i64 0
+    %16 = load i64, ptr %15
+    %17 = mul nsw i64 %13, %16
+    %18 = load ptr, ptr %3
+    %19 = getelementptr inbounds i64, ptr %18, i64 0
+    store i64 %17, ptr %19
+    %20 = load ptr, ptr %2
+    %21 = getelementptr inbounds ptr, ptr %20, i64 1
+    %22 = load ptr, ptr %21
+    %23 = load ptr, ptr %3
+    %24 = call i1 @chan_send(ptr %22, ptr %23)
+    br label %L1
+L3:
+    %25 = load ptr, ptr %3
+    call void @dealloc(ptr %25)
+    %26 = load ptr, ptr %1
+    ret ptr %26
+}
+define ptr @collect(ptr %0) nounwind {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = call ptr @alloc(i64 8)
+    store ptr %4, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %5 = load ptr, ptr %1
+    %6 = load ptr, ptr %2
+    %7 = call i1 @chan_recv(ptr %5, ptr %6)
+    br i1 %7, label %L2, label %L3
+L2:
+    %8 = load i64, ptr %3
+    %9 = load ptr, ptr %2
+    %10 = getelementptr inbounds i64, ptr %9, i64 0
+    %11 = load i64, ptr %10
+    %12 = add nsw i64 %8, %11
+    store i64 %12, ptr %3
+    br label %L1
+L3:
+    %13 = load ptr, ptr %2
+    call void @dealloc(ptr %13)
+    %14 = load i64, ptr %3
+    %15 = inttoptr i64 %14 to ptr
+    ret ptr %15
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca double
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca ptr
+    %4 = alloca ptr
+    %5 = alloca ptr
+    %6 = alloca i64
+    %7 = alloca i64
+    %8 = alloca i64
+    %9 = call double @pc_time()
+    %10 = fneg double %9
+    store double %10, ptr %0
+    %11 = mul nsw i64 8, 2
+    %12 = call ptr @alloc(i64 %11)
+    store ptr %12, ptr %1
+    %13 = call ptr @chan_create(i64 64, i64 8)
+    %14 = load ptr, ptr %1
+    %15 = getelementptr inbounds ptr, ptr %14, i64 0
+    store ptr %13, ptr %15
+    %16 = call ptr @chan_create(i64 64, i64 8)
+    %17 = load ptr, ptr %1
+    %18 = getelementptr inbounds ptr, ptr %17, i64 1
+    store ptr %16, ptr %18
+    %19 = load ptr, ptr %1
+    %20 = getelementptr inbounds ptr, ptr %19, i64 1
+    %21 = load ptr, ptr %20
+    %22 = call i64 @thread_create(ptr @collect, ptr %21)
+    store i64 %22, ptr %2
+    %23 = mul nsw i64 8, 4
+    %24 = call ptr @alloc(i64 %23)
+    store ptr %24, ptr %3
+    %25 = load ptr, ptr %1
+    %26 = getelementptr inbounds ptr, ptr %25, i64 0
+    %27 = load ptr, ptr %26
+    %28 = call i64 @thread_create(ptr @produce, ptr %27)
+    %29 = load ptr, ptr %3
+    %30 = getelementptr inbounds i64, ptr %29, i64 0
+    store i64 %28, ptr %30
+    %31 = load ptr, ptr %1
+    %32 = getelementptr inbounds ptr, ptr %31, i64 0
+    %33 = load ptr, ptr %32
+    %34 = call i64 @thread_create(ptr @produce, ptr %33)
+    %35 = load ptr, ptr %3
+    %36 = getelementptr inbounds i64, ptr %35, i64 1
+    store i64 %34, ptr %36
+    %37 = load ptr, ptr %1
+    %38 = call i64 @thread_create(ptr @square, ptr %37)
+    %39 = load ptr, ptr %3
+    %40 = getelementptr inbounds i64, ptr %39, i64 2
+    store i64 %38, ptr %40
+    %41 = load ptr, ptr %1
+    %42 = call i64 @thread_create(ptr @square, ptr %41)
+    %43 = load ptr, ptr %3
+    %44 = getelementptr inbounds i64, ptr %43, i64 3
+    store i64 %42, ptr %44
+    %45 = load ptr, ptr %3
+    %46 = getelementptr inbounds i64, ptr %45, i64 0
+    %47 = load i64, ptr %46
+    %48 = call ptr @thread_join(i64 %47)
+    %49 = load ptr, ptr %3
+    %50 = getelementptr inbounds i64, ptr %49, i64 1
+    %51 = load i64, ptr %50
+    %52 = call ptr @thread_join(i64 %51)
+    %53 = load ptr, ptr %1
+    %54 = getelementptr inbounds ptr, ptr %53, i64 0
+    %55 = load ptr, ptr %54
+    call void @chan_close(ptr %55)
+    %56 = load ptr, ptr %3
+    %57 = getelementptr inbounds i64, ptr %56, i64 2
+    %58 = load i64, ptr %57
+    %59 = call ptr @thread_join(i64 %58)
+    %60 = load ptr, ptr %3
+    %61 = getelementptr inbounds i64, ptr %60, i64 3
+    %62 = load i64, ptr %61
+    %63 = call ptr @thread_join(i64 %62)
+    %64 = load ptr, ptr %1
+    %65 = getelementptr inbounds ptr, ptr %64, i64 1
+    %66 = load ptr, ptr %65
+    call void @chan_close(ptr %66)
+    %67 = load i64, ptr %2
+    %68 = call ptr @thread_join(i64 %67)
+    %69 = ptrtoint ptr %68 to i64
+    call void @printint(i64 %69)
+    %70 = load double, ptr %0
+    %71 = call double @pc_time()
+    %72 = fadd double %70, %71
+    store double %72, ptr %0
+    %73 = load double, ptr %0
+    %74 = fmul double %73, 1000000.000000
+    %75 = load i64, ptr @n
+    %76 = mul nsw i64 %75, 2
+    %77 = sitofp i64 %76 to double
+    %78 = fdiv double %74, %77
+    call void @printfloat(double %78)
+    %79 = load ptr, ptr %1
+    %80 = getelementptr inbounds ptr, ptr %79, i64 0
+    %81 = load ptr, ptr %80
+    call void @chan_destroy(ptr %81)
+    %82 = load ptr, ptr %1
+    %83 = getelementptr inbounds ptr, ptr %82, i64 1
+    %84 = load ptr, ptr %83
+    call void @chan_destroy(ptr %84)
+    %85 = load ptr, ptr %3
+    call void @dealloc(ptr %85)
+    %86 = load ptr, ptr %1
+    call void @dealloc(ptr %86)
+    %87 = call ptr @chan_create(i64 4, i64 8)
+    store ptr %87, ptr %4
+    %88 = call ptr @alloc(i64 8)
+    store ptr %88, ptr %5
+    store i64 0, ptr %6
+    store i64 0, ptr %7
+    br label %L1
+L1:
+    %89 = load i64, ptr %7
+    %90 = icmp slt i64 %89, 6
+    br i1 %90, label %L2, label %L3
+L2:
+    %91 = load i64, ptr %7
+    %92 = load ptr, ptr %5
+    %93 = getelementptr inbounds i64, ptr %92, i64 0
+    store i64 %91, ptr %93
+    %94 = load ptr, ptr %4
+    %95 = load ptr, ptr %5
+    %96 = call i1 @chan_try_send(ptr %94, ptr %95)
+    br i1 %96, label %L4, label %L5
+L4:
+    %97 = load i64, ptr %6
+    %98 = add nsw i64 %97, 1
+    store i64 %98, ptr %6
+    br label %L6
+L5:
+    br label %L6
+L6:
+    %99 = load i64, ptr %7
+    %100 = add nsw i64 %99, 1
+    store i64 %100, ptr %7
+    br label %L1
+L3:
+    %101 = load i64, ptr %6
+    call void @printint(i64 %101)
+    %102 = load ptr, ptr %4
+    call void @chan_close(ptr %102)
+    %103 = alloca i64
+    %104 = load ptr, ptr %4
+    %105 = load ptr, ptr %5
+    %106 = call i1 @chan_send(ptr %104, ptr %105)
+    br i1 %106, label %L7, label %L8
+L7:
+    store i64 1, ptr %103
+    br label %L9
+L8:
+    store i64 0, ptr %103
+    br label %L9
+L9:
+    %107 = load i64, ptr %103
+    call void @printint(i64 %107)
+    store i64 0, ptr %8
+    br label %L10
+L10:
+    %108 = load ptr, ptr %4
+    %109 = load ptr, ptr %5
+    %110 = call i1 @chan_recv(ptr %108, ptr %109)
+    br i1 %110, label %L11, label %L12
+L11:
+    %111 = load i64, ptr %8
+    %112 = load ptr, ptr %5
+    %113 = getelementptr inbounds i64, ptr %112, i64 0
+    %114 = load i64, ptr %113
+    %115 = add nsw i64 %111, %114
+    store i64 %115, ptr %8
+    br label %L10
+L12:
+    %116 = load i64, ptr %8
+    call void @printint(i64 %116)
+    %117 = load ptr, ptr %5
+    call void @dealloc(ptr %117)
+    %118 = load ptr, ptr %4
+    call void @chan_destroy(ptr %118)
+    ret i64 0
+}
@@ -0,0 +1,230 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @sum({ ptr, i64 } %0) readonly nounwind norecurse {
+L0:
+    %1 = alloca { ptr, i64 }
+    store { ptr, i64 } %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = extractvalue { ptr, i64 } %0, 1
+    %5 = icmp sge i64 %4, 0
+    call void @llvm.assume(i1 %5)
+    store i64 0, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %6 = load i64, ptr %3
+    %7 = load { ptr, i64 }, ptr %1
+    %8 = extractvalue { ptr, i64 } %7, 1
+    %9 = icmp slt i64 %6, %8
+    br i1 %9, label %L2, label %L3
+L2:
+    %10 = load i64, ptr %2
+    %11 = load { ptr, i64 }, ptr %1
+    %12 = load i64, ptr %3
+    %13 = extractvalue { ptr, i64 } %11, 1
+    %14 = icmp ult i64 %12, %13
+    br i1 %14, label %L4, label %L5, !prof !10
+L5:
+    call void @llvm.trap()
+    unreachable
+L4:
+    %15 = extractvalue { ptr, i64 } %11, 0
+    %16 = getelementptr inbounds i64, ptr %15, i64 %12
+    %17 = load i64, ptr %16
+    %18 = add nsw i64 %10, %17
+    store i64 %18, ptr %2
+    %19 = load i64, ptr %3
+    %20 = add nsw i64 %19, 1
+    store i64 %20, ptr %3
+    br label %L1
+L3:
+    %21 = load i64, ptr %2
+    ret i64 %21
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca { ptr, i64 }
+    store i64 8, ptr %0
+    %4 = load i64, ptr %0
+    %5 = mul nsw i64 8, %4
+    %6 = call ptr @alloc(i64 %5)
+    store ptr %6, ptr %1
+    store i64 0, ptr %2
+    br label %L1
+L1:
+    %7 = load i64, ptr %2
+    %8 = load i64, ptr %0
+    %9 = icmp slt i64 %7, %8
+    br i1 %9, label %L2, label %L3
+L2:
+    %10 = load i64, ptr %2
+    %11 = add nsw i64 %10, 1
+    %12 = load ptr, ptr %1
+    %13 = load i64, ptr %2
+    %14 = getelementptr inbounds i64, ptr %12, i64 %13
+    store i64 %11, ptr %14
+    %15 = load i64, ptr %2
+    %16 = add nsw i64 %15, 1
+    store i64 %16, ptr %2
+    br label %L1
+L3:
+    %17 = load ptr, ptr %1
+    %18 = icmp sle i64 0, 4
+    br i1 %18, label %L4, label %L5, !prof !10
+L5:
+    call void @llvm.trap()
+    unreachable
+L4:
+    %19 = getelementptr inbounds i64, ptr %17, i64 0
+    %20 = sub i64 4, 0
+    %21 = insertvalue { ptr, i64 } undef, ptr %19, 0
+    %22 = insertvalue { ptr, i64 } %21, i64 %20, 1
+    store { ptr, i64 } %22, ptr %3
+    %23 = load { ptr, i64 }, ptr %3
+    %24 = call i64 @sum({ ptr, i64 } %23)
+    call void @printint(i64 %24)
+    %25 = load { ptr, i64 }, ptr %3
+    %26 = extractvalue { ptr, i64 } %25, 0
+    %27 = extractvalue { ptr, i64 } %25, 1
+    %28 = icmp ule i64 1, %27
+    br i1 %28, label %L6, label %L7, !prof !10
+L7:
+    call void @llvm.trap()
+    unreachable
+L6:
+    %29 = getelementptr inbounds i64, ptr %26, i64 1
+    %30 = sub i64 %27, 1
+    %31 = insertvalue { ptr, i64 } undef, ptr %29, 0
+    %32 = insertvalue { ptr, i64 } %31, i64 %30, 1
+    %33 = call i64 @sum({ ptr, i64 } %32)
+    call void @printint(i64 %33)
+    %34 = load ptr, ptr %1
+    %35 = load i64, ptr %0
+    %36 = icmp sle i64 2, %35
+    br i1 %36, label %L8, label %L9, !prof !10
+L9:
+    call void @llvm.trap()
+    unreachable
+L8:
+    %37 = getelementptr inbounds i64, ptr %34, i64 2
+    %38 = sub i64 %35, 2
+    %39 = insertvalue { ptr, i64 } undef, ptr %37, 0
+    %40 = insertvalue { ptr, i64 } %39, i64 %38, 1
+    %41 = extractvalue { ptr, i64 } %40, 0
+    %42 = extractvalue { ptr, i64 } %40, 1
+    %43 = icmp ule i64 1, 4
+    %44 = icmp ule i64 4, %42
+    %45 = and i1 %43, %44
+    br i1 %45, label %L10, label %L11, !prof !10
+L11:
+    call void @llvm.trap()
+    unreachable
+L10:
+    %46 = getelementptr inbounds i64, ptr %41, i64 1
+    %47 = sub i64 4, 1
+    %48 = insertvalue { ptr, i64 } undef, ptr %46, 0
+    %49 = insertvalue { ptr, i64 } %48, i64 %47, 1
+    %50 = call i64 @sum({ ptr, i64 } %49)
+    call void @printint(i64 %50)
+    %51 = load { ptr, i64 }, ptr %3
+    %52 = extractvalue { ptr, i64 } %51, 1
+    %53 = icmp ult i64 3, %52
+    br i1 %53, label %L12, label %L13, !prof !10
+L13:
+    call void @llvm.trap()
+    unreachable
+L12:
+    %54 = extractvalue { ptr, i64 } %51, 0
+    %55 = getelementptr inbounds i64, ptr %54, i64 3
+    store i64 10, ptr %55
+    %56 = load { ptr, i64 }, ptr %3
+    %57 = extractvalue { ptr, i64 } %56, 1
+    %58 = icmp ult i64 3, %57
+    br i1 %58, label %L14, label %L15, !prof !10
+L15:
+    call void @llvm.trap()
+    unreachable
+L14:
+    %59 = extractvalue { ptr, i64 } %56, 0
+    %60 = getelementptr inbounds i64, ptr %59, i64 3
+    %61 = load i64, ptr %60
+    call void @printint(i64 %61)
+    call void @flush_output()
+    %62 = load { ptr, i64 }, ptr %3
+    %63 = extractvalue { ptr, i64 } %62, 1
+    %64 = icmp ult i64 4, %63
+    br i1 %64, label %L16, label %L17, !prof !10
+L17:
+    call void @llvm.trap()
+    unreachable
+L16:
+    %65 = extractvalue { ptr, i64 } %62, 0
+    %66 = getelementptr inbounds i64, ptr %65, i64 4
+    %67 = load i64, ptr %66
+    call void @printint(i64 %67)
+    ret i64 0
+}
+declare void @llvm.assume(i1 noundef)
+declare void @llvm.trap() cold noreturn nounwind
+!10 = !{!"branch_weights", i32 2000, i32 1}
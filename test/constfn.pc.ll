@@ -0,0 +1,280 @@
+@table_size = global i64 1009
+@fib20 = global i64 6765
+@divisor = global i64 12
+@mixed = global i32 2653896249
+@root2 = global double 0x3FF6A09E667F3BCC
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @fib(i64 %0) readnone nounwind {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca i64
+    %3 = load i64, ptr %1
+    %4 = icmp slt i64 %3, 2
+    br i1 %4, label %L1, label %L2
+L1:
+    %5 = load i64, ptr %1
+    store i64 %5, ptr %2
+    br label %L3
+L2:
+    %6 = load i64, ptr %1
+    %7 = sub nsw i64 %6, 1
+    %8 = call i64 @fib(i64 %7)
+    %9 = load i64, ptr %1
+    %10 = sub nsw i64 %9, 2
+    %11 = call i64 @fib(i64 %10)
+    %12 = add nsw i64 %8, %11
+    store i64 %12, ptr %2
+    br label %L3
+L3:
+    %13 = load i64, ptr %2
+    ret i64 %13
+}
+define i64 @gcd(i64 %0, i64 %1) readnone nounwind norecurse {
+L0:
+    %2 = alloca i64
+    store i64 %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i64
+    br label %L1
+L1:
+    %5 = load i64, ptr %3
+    %6 = icmp ne i64 %5, 0
+    br i1 %6, label %L2, label %L3
+L2:
+    %7 = load i64, ptr %2
+    %8 = load i64, ptr %3
+    %9 = srem i64 %7, %8
+    store i64 %9, ptr %4
+    %10 = load i64, ptr %3
+    store i64 %10, ptr %2
+    %11 = load i64, ptr %4
+    store i64 %11, ptr %3
+    br label %L1
+L3:
+    %12 = load i64, ptr %2
+    ret i64 %12
+}
+define i64 @next_prime(i64 %0) readnone nounwind norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca i1
+    %5 = load i64, ptr %1
+    %6 = add nsw i64 %5, 1
+    store i64 %6, ptr %2
+    br label %L1
+L1:
+    br i1 1, label %L2, label %L3
+L2:
+    store i64 2, ptr %3
+    store i1 1, ptr %4
+    br label %L4
+L4:
+    %7 = load i64, ptr %3
+    %8 = load i64, ptr %3
+    %9 = mul nsw i64 %7, %8
+    %10 = load i64, ptr %2
+    %11 = icmp sle i64 %9, %10
+    br i1 %11, label %L5, label %L6
+L5:
+    %12 = load i64, ptr %2
+    %13 = load i64, ptr %3
+    %14 = srem i64 %12, %13
+    %15 = icmp eq i64 %14, 0
+    br i1 %15, label %L7, label %L8
+L7:
+    store i1 0, ptr %4
+    br label %L6
+L8:
+    br label %L9
+L9:
+    %16 = load i64, ptr %3
+    %17 = add nsw i64 %16, 1
+    store i64 %17, ptr %3
+    br label %L4
+L6:
+    %18 = load i1, ptr %4
+    br i1 %18, label %L10, label %L11
+L10:
+    %19 = load i64, ptr %2
+    ret i64 %19
+L11:
+    br label %L12
+L12:
+    %20 = load i64, ptr %2
+    %21 = add nsw i64 %20, 1
+    store i64 %21, ptr %2
+    br label %L1
+L3:
+    unreachable
+}
+define i32 @hash(i32 %0, i64 %1) readnone nounwind norecurse {
+L0:
+    %2 = alloca i32
+    store i32 %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i32
+    %5 = alloca i64
+    %6 = load i32, ptr %2
+    store i32 %6, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %7 = load i64, ptr %5
+    %8 = load i64, ptr %3
+    %9 = icmp slt i64 %7, %8
+    br i1 %9, label %L2, label %L3
+L2:
+    %10 = load i32, ptr %4
+    %11 = load i32, ptr %4
+    %12 = shl i32 %11, 13
+    %13 = xor i32 %10, %12
+    store i32 %13, ptr %4
+    %14 = load i32, ptr %4
+    %15 = load i32, ptr %4
+    %16 = lshr i32 %15, 17
+    %17 = xor i32 %14, %16
+    store i32 %17, ptr %4
+    %18 = load i32, ptr %4
+    %19 = load i32, ptr %4
+    %20 = shl i32 %19, 5
+    %21 = xor i32 %18, %20
+    store i32 %21, ptr %4
+    %22 = load i64, ptr %5
+    %23 = add nsw i64 %22, 1
+    store i64 %23, ptr %5
+    br label %L1
+L3:
+    %24 = load i32, ptr %4
+    ret i32 %24
+}
+define double @sqrt(double %0) readnone nounwind norecurse {
+L0:
+    %1 = alloca double
+    store double %0, ptr %1
+    %2 = alloca double
+    %3 = alloca i64
+    %4 = load double, ptr %1
+    store double %4, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %5 = load i64, ptr %3
+    %6 = icmp slt i64 %5, 32
+    br i1 %6, label %L2, label %L3
+L2:
+    %7 = load double, ptr %2
+    %8 = load double, ptr %1
+    %9 = load double, ptr %2
+    %10 = fdiv double %8, %9
+    %11 = fadd double %7, %10
+    %12 = fdiv double %11, 2.000000
+    store double %12, ptr %2
+    %13 = load i64, ptr %3
+    %14 = add nsw i64 %13, 1
+    store i64 %14, ptr %3
+    br label %L1
+L3:
+    %15 = load double, ptr %2
+    ret double %15
+}
+define i64 @forever(i64 %0) readnone nounwind norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    br label %L1
+L1:
+    %2 = load i64, ptr %1
+    %3 = icmp sgt i64 %2, 0
+    br i1 %3, label %L2, label %L3
+L2:
+    %4 = load i64, ptr %1
+    %5 = add nsw i64 %4, 1
+    store i64 %5, ptr %1
+    br label %L1
+L3:
+    %6 = load i64, ptr %1
+    ret i64 %6
+}
+define i64 @main() nounwind {
+L0:
+    %0 = load i64, ptr @table_size
+    call void @printint(i64 %0)
+    %1 = load i64, ptr @fib20
+    call void @printint(i64 %1)
+    %2 = load i64, ptr @divisor
+    call void @printint(i64 %2)
+    %3 = load i32, ptr @mixed
+    %4 = zext i32 %3 to i64
+    call void @printuint(i64 %4)
+    %5 = load double, ptr @root2
+    call void @printfloat(double %5)
+    %6 = call i64 @fib(i64 10)
+    %7 = call i64 @forever(i64 -1)
+    %8 = add nsw i64 %6, %7
+    call void @printint(i64 %8)
+    ret i64 0
+}
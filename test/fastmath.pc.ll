@@ -0,0 +1,233 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define double @dot(ptr %0, ptr %1, i64 %2) readonly nounwind norecurse {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca ptr
+    store ptr %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca double
+    %7 = alloca i64
+    store double 0.000000, ptr %6
+    store i64 0, ptr %7
+    br label %L1
+L1:
+    %8 = load i64, ptr %7
+    %9 = load i64, ptr %5
+    %10 = icmp slt i64 %8, %9
+    br i1 %10, label %L2, label %L3
+L2:
+    %11 = load double, ptr %6
+    %12 = load ptr, ptr %3
+    %13 = load i64, ptr %7
+    %14 = getelementptr inbounds double, ptr %12, i64 %13
+    %15 = load double, ptr %14
+    %16 = load ptr, ptr %4
+    %17 = load i64, ptr %7
+    %18 = getelementptr inbounds double, ptr %16, i64 %17
+    %19 = load double, ptr %18
+    %20 = fmul fast double %15, %19
+    %21 = fadd fast double %11, %20
+    store double %21, ptr %6
+    %22 = load i64, ptr %7
+    %23 = add nsw i64 %22, 1
+    store i64 %23, ptr %7
+    br label %L1
+L3:
+    %24 = load double, ptr %6
+    ret double %24
+}
+define double @sum(ptr %0, i64 %1) readonly nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca double
+    %5 = alloca i64
+    store double 0.000000, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %6 = load i64, ptr %5
+    %7 = load i64, ptr %3
+    %8 = icmp slt i64 %6, %7
+    br i1 %8, label %L2, label %L3
+L2:
+    %9 = load double, ptr %4
+    %10 = load ptr, ptr %2
+    %11 = load i64, ptr %5
+    %12 = getelementptr inbounds double, ptr %10, i64 %11
+    %13 = load double, ptr %12
+    %14 = fadd double %9, %13
+    store double %14, ptr %4
+    %15 = load i64, ptr %5
+    %16 = add nsw i64 %15, 1
+    store i64 %16, ptr %5
+    br label %L1
+L3:
+    %17 = load double, ptr %4
+    ret double %17
+}
+define double @clamp(double %0, double %1, double %2) readnone nounwind willreturn norecurse {
+L0:
+    %3 = alloca double
+    store double %0, ptr %3
+    %4 = alloca double
+    store double %1, ptr %4
+    %5 = alloca double
+    store double %2, ptr %5
+    %6 = alloca double
+    %7 = load double, ptr %3
+    %8 = load double, ptr %4
+    %9 = fcmp fast olt double %7, %8
+    br i1 %9, label %L1, label %L2
+L1:
+    %10 = load double, ptr %4
+    store double %10, ptr %6
+    br label %L3
+L2:
+    %11 = alloca double
+    %12 = load double, ptr %3
+    %13 = load double, ptr %5
+    %14 = fcmp fast ogt double %12, %13
+    br i1 %14, label %L4, label %L5
+L4:
+    %15 = load double, ptr %5
+    store double %15, ptr %11
+    br label %L6
+L5:
+    %16 = load double, ptr %3
+    store double %16, ptr %11
+    br label %L6
+L6:
+    %17 = load double, ptr %11
+    store double %17, ptr %6
+    br label %L3
+L3:
+    %18 = load double, ptr %6
+    ret double %18
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca ptr
+    %3 = alloca i64
+    store i64 1000, ptr %0
+    %4 = load i64, ptr %0
+    %5 = mul nsw i64 8, %4
+    %6 = call ptr @alloc(i64 %5)
+    store ptr %6, ptr %1
+    %7 = load i64, ptr %0
+    %8 = mul nsw i64 8, %7
+    %9 = call ptr @alloc(i64 %8)
+    store ptr %9, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %10 = load i64, ptr %3
+    %11 = load i64, ptr %0
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load i64, ptr %3
+    %14 = sitofp i64 %13 to double
+    %15 = load ptr, ptr %1
+    %16 = load i64, ptr %3
+    %17 = getelementptr inbounds double, ptr %15, i64 %16
+    store double %14, ptr %17
+    %18 = load i64, ptr %3
+    %19 = srem i64 %18, 4
+    %20 = sitofp i64 %19 to double
+    %21 = fmul double %20, 0.500000
+    %22 = load ptr, ptr %2
+    %23 = load i64, ptr %3
+    %24 = getelementptr inbounds double, ptr %22, i64 %23
+    store double %21, ptr %24
+    %25 = load i64, ptr %3
+    %26 = add nsw i64 %25, 1
+    store i64 %26, ptr %3
+    br label %L1
+L3:
+    %27 = load ptr, ptr %1
+    %28 = load ptr, ptr %2
+    %29 = load i64, ptr %0
+    %30 = call double @dot(ptr %27, ptr %28, i64 %29)
+    call void @printfloat(double %30)
+    %31 = load ptr, ptr %1
+    %32 = load i64, ptr %0
+    %33 = call double @sum(ptr %31, i64 %32)
+    call void @printfloat(double %33)
+    %34 = load ptr, ptr %2
+    %35 = load i64, ptr %0
+    %36 = call double @sum(ptr %34, i64 %35)
+    %37 = fneg double %36
+    %38 = fneg double 100.000000
+    %39 = call double @clamp(double %37, double %38, double 100.000000)
+    call void @printfloat(double %39)
+    %40 = load ptr, ptr %2
+    call void @dealloc(ptr %40)
+    %41 = load ptr, ptr %1
+    call void @dealloc(ptr %41)
+    ret i64 0
+}
@@ -0,0 +1,223 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @digit(i64 %0) readnone nounwind willreturn norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca i1
+    %3 = load i64, ptr %1
+    %4 = icmp sge i64 %3, 0
+    br i1 %4, label %L1, label %L2
+L1:
+    %5 = load i64, ptr %1
+    %6 = icmp slt i64 %5, 16
+    store i1 %6, ptr %2
+    br label %L3
+L2:
+    store i1 0, ptr %2
+    br label %L3
+L3:
+    %7 = load i1, ptr %2
+    call void @llvm.assume(i1 %7)
+    %8 = alloca i64
+    %9 = load i64, ptr %1
+    %10 = icmp slt i64 %9, 10
+    br i1 %10, label %L4, label %L5
+L4:
+    %11 = load i64, ptr %1
+    store i64 %11, ptr %8
+    br label %L6
+L5:
+    %12 = alloca i64
+    %13 = load i64, ptr %1
+    %14 = icmp slt i64 %13, 16
+    br i1 %14, label %L7, label %L8
+L7:
+    %15 = load i64, ptr %1
+    %16 = sub nsw i64 %15, 10
+    store i64 %16, ptr %12
+    br label %L9
+L8:
+    unreachable
+L9:
+    %17 = load i64, ptr %12
+    store i64 %17, ptr %8
+    br label %L6
+L6:
+    %18 = load i64, ptr %8
+    ret i64 %18
+}
+define i64 @chase(ptr %0, i64 %1, i64 %2) readonly nounwind norecurse {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca i64
+    %7 = alloca i64
+    %8 = load i64, ptr %4
+    store i64 %8, ptr %6
+    store i64 0, ptr %7
+    br label %L1
+L1:
+    %9 = load i64, ptr %5
+    %10 = icmp sgt i64 %9, 0
+    br i1 %10, label %L2, label %L3, !prof !10
+L2:
+    %11 = load ptr, ptr %3
+    %12 = load ptr, ptr %3
+    %13 = load i64, ptr %6
+    %14 = getelementptr inbounds i64, ptr %12, i64 %13
+    %15 = load i64, ptr %14
+    %16 = getelementptr inbounds i64, ptr %11, i64 %15
+    call void @llvm.prefetch(ptr %16, i32 0, i32 3, i32 1)
+    %17 = load i64, ptr %7
+    %18 = load i64, ptr %6
+    %19 = add nsw i64 %17, %18
+    store i64 %19, ptr %7
+    %20 = load ptr, ptr %3
+    %21 = load i64, ptr %6
+    %22 = getelementptr inbounds i64, ptr %20, i64 %21
+    %23 = load i64, ptr %22
+    store i64 %23, ptr %6
+    %24 = load i64, ptr %5
+    %25 = add nsw i64 %24, -1
+    store i64 %25, ptr %5
+    br label %L1
+L3:
+    %26 = load i64, ptr %7
+    ret i64 %26
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca i64
+    store i64 1024, ptr %0
+    %4 = load i64, ptr %0
+    %5 = mul nsw i64 8, %4
+    %6 = call ptr @alloc(i64 %5)
+    store ptr %6, ptr %1
+    store i64 0, ptr %2
+    br label %L1
+L1:
+    %7 = load i64, ptr %2
+    %8 = load i64, ptr %0
+    %9 = icmp slt i64 %7, %8
+    br i1 %9, label %L2, label %L3
+L2:
+    %10 = load i64, ptr %2
+    %11 = mul nsw i64 %10, 37
+    %12 = add nsw i64 %11, 11
+    %13 = load i64, ptr %0
+    %14 = srem i64 %12, %13
+    %15 = load ptr, ptr %1
+    %16 = load i64, ptr %2
+    %17 = getelementptr inbounds i64, ptr %15, i64 %16
+    store i64 %14, ptr %17
+    %18 = load i64, ptr %2
+    %19 = add nsw i64 %18, 1
+    store i64 %19, ptr %2
+    br label %L1
+L3:
+    %20 = load ptr, ptr %1
+    %21 = call i64 @chase(ptr %20, i64 0, i64 100000)
+    call void @printint(i64 %21)
+    store i64 0, ptr %3
+    store i64 0, ptr %2
+    br label %L4
+L4:
+    %22 = load i64, ptr %2
+    %23 = icmp slt i64 %22, 100
+    br i1 %23, label %L5, label %L6
+L5:
+    %24 = load i64, ptr %2
+    %25 = srem i64 %24, 10
+    %26 = icmp eq i64 %25, 9
+    br i1 %26, label %L7, label %L8, !prof !11
+L7:
+    %27 = load i64, ptr %3
+    %28 = load i64, ptr %2
+    %29 = srem i64 %28, 16
+    %30 = call i64 @digit(i64 %29)
+    %31 = add nsw i64 %27, %30
+    store i64 %31, ptr %3
+    br label %L9
+L8:
+    br label %L9
+L9:
+    %32 = load i64, ptr %2
+    %33 = add nsw i64 %32, 1
+    store i64 %33, ptr %2
+    br label %L4
+L6:
+    %34 = load i64, ptr %3
+    call void @printint(i64 %34)
+    %35 = load ptr, ptr %1
+    call void @dealloc(ptr %35)
+    ret i64 0
+}
+declare void @llvm.assume(i1 noundef)
+declare void @llvm.prefetch(ptr, i32, i32, i32)
+!10 = !{!"branch_weights", i32 2000, i32 1}
+!11 = !{!"branch_weights", i32 1, i32 2000}
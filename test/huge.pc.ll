@@ -0,0 +1,174 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define void @stream(ptr %0, i64 %1) nounwind {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca double
+    %5 = alloca i64
+    %6 = alloca i64
+    %7 = call double @pc_time()
+    %8 = fneg double %7
+    store double %8, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %9 = load i64, ptr %5
+    %10 = load i64, ptr %3
+    %11 = icmp slt i64 %9, %10
+    br i1 %11, label %L2, label %L3
+L2:
+    %12 = load i64, ptr %5
+    %13 = add nsw i64 %12, 1
+    %14 = load ptr, ptr %2
+    %15 = load i64, ptr %5
+    %16 = getelementptr inbounds i64, ptr %14, i64 %15
+    store i64 %13, ptr %16
+    %17 = load i64, ptr %5
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %5
+    br label %L1
+L3:
+    %19 = load double, ptr %4
+    %20 = call double @pc_time()
+    %21 = fadd double %19, %20
+    store double %21, ptr %4
+    %22 = load double, ptr %4
+    %23 = fmul double %22, 1000.000000
+    call void @printfloat(double %23)
+    store i64 0, ptr %6
+    %24 = call double @pc_time()
+    %25 = fneg double %24
+    store double %25, ptr %4
+    store i64 0, ptr %5
+    br label %L4
+L4:
+    %26 = load i64, ptr %5
+    %27 = icmp slt i64 %26, 5
+    br i1 %27, label %L5, label %L6
+L5:
+    %28 = load i64, ptr %6
+    %29 = load ptr, ptr %2
+    %30 = load i64, ptr %3
+    %31 = call i64 @reduce_sum_int(ptr %29, i64 %30)
+    %32 = add nsw i64 %28, %31
+    store i64 %32, ptr %6
+    %33 = load i64, ptr %5
+    %34 = add nsw i64 %33, 1
+    store i64 %34, ptr %5
+    br label %L4
+L6:
+    %35 = load double, ptr %4
+    %36 = call double @pc_time()
+    %37 = fadd double %35, %36
+    store double %37, ptr %4
+    %38 = load i64, ptr %6
+    call void @printint(i64 %38)
+    %39 = load double, ptr %4
+    %40 = fmul double %39, 1000.000000
+    call void @printfloat(double %40)
+    ret void
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca ptr
+    %3 = alloca ptr
+    store i64 50000000, ptr %0
+    %4 = load i64, ptr %0
+    %5 = mul nsw i64 8, %4
+    %6 = call ptr @alloc(i64 %5)
+    store ptr %6, ptr %1
+    %7 = load ptr, ptr %1
+    %8 = load i64, ptr %0
+    call void @stream(ptr %7, i64 %8)
+    %9 = load ptr, ptr %1
+    call void @dealloc(ptr %9)
+    %10 = load i64, ptr %0
+    %11 = mul nsw i64 8, %10
+    %12 = call ptr @alloc_aligned(i64 %11, i64 64)
+    store ptr %12, ptr %2
+    %13 = load ptr, ptr %2
+    %14 = ptrtoint ptr %13 to i64
+    %15 = srem i64 %14, 64
+    call void @printint(i64 %15)
+    %16 = load ptr, ptr %2
+    %17 = load i64, ptr %0
+    call void @stream(ptr %16, i64 %17)
+    %18 = load ptr, ptr %2
+    call void @dealloc_aligned(ptr %18)
+    %19 = load i64, ptr %0
+    %20 = mul nsw i64 8, %19
+    %21 = call ptr @alloc_huge(i64 %20)
+    store ptr %21, ptr %3
+    %22 = load ptr, ptr %3
+    %23 = ptrtoint ptr %22 to i64
+    %24 = srem i64 %23, 64
+    call void @printint(i64 %24)
+    %25 = load ptr, ptr %3
+    %26 = load i64, ptr %0
+    call void @stream(ptr %25, i64 %26)
+    %27 = load ptr, ptr %3
+    call void @dealloc_huge(ptr %27)
+    ret i64 0
+}
@@ -0,0 +1,235 @@
+@path = unnamed_addr constant [10 x i8] [i8 105, i8 110, i8 112, i8 117, i8 116, i8 46, i8 116, i8 120, i8 116, i8 0], align 1
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = alloca i64
+    %6 = alloca i64
+    %7 = alloca double
+    %8 = alloca i64
+    %9 = alloca double
+    store i64 10000000, ptr %0
+    %10 = load i64, ptr %0
+    %11 = mul nsw i64 8, %10
+    %12 = call ptr @alloc(i64 %11)
+    store ptr %12, ptr %1
+    %13 = load i64, ptr %0
+    %14 = mul nsw i64 8, %13
+    %15 = call ptr @alloc(i64 %14)
+    store ptr %15, ptr %2
+    store i64 0, ptr %3
+    store i64 0, ptr %4
+    br label %L1
+L1:
+    %16 = load i64, ptr %3
+    %17 = load i64, ptr %0
+    %18 = icmp slt i64 %16, %17
+    br i1 %18, label %L2, label %L3
+L2:
+    %19 = load i64, ptr %3
+    %20 = mul i64 %19, 2654435761
+    %21 = srem i64 %20, 2000000001
+    %22 = sub nsw i64 %21, 1000000000
+    %23 = load ptr, ptr %1
+    %24 = load i64, ptr %3
+    %25 = getelementptr inbounds i64, ptr %23, i64 %24
+    store i64 %22, ptr %25
+    %26 = load i64, ptr %4
+    %27 = load ptr, ptr %1
+    %28 = load i64, ptr %3
+    %29 = getelementptr inbounds i64, ptr %27, i64 %28
+    %30 = load i64, ptr %29
+    %31 = add nsw i64 %26, %30
+    store i64 %31, ptr %4
+    %32 = load i64, ptr %3
+    %33 = add nsw i64 %32, 1
+    store i64 %33, ptr %3
+    br label %L1
+L3:
+    %34 = call i64 @open_file(ptr @path, i1 1)
+    store i64 %34, ptr %5
+    %35 = load i64, ptr %5
+    %36 = load ptr, ptr %1
+    %37 = load i64, ptr %0
+    call void @write_int_array(i64 %35, ptr %36, i64 %37, i64 10)
+    %38 = load i64, ptr %5
+    call void @close_file(i64 %38)
+    %39 = load i64, ptr %4
+    call void @printint(i64 %39)
+    %40 = call i64 @file_size(ptr @path)
+    call void @printint(i64 %40)
+    %41 = call i64 @open_file(ptr @path, i1 0)
+    store i64 %41, ptr %6
+    %42 = call double @pc_time()
+    %43 = fneg double %42
+    store double %43, ptr %7
+    %44 = load i64, ptr %6
+    %45 = load ptr, ptr %1
+    %46 = load i64, ptr %0
+    %47 = sdiv i64 %46, 3
+    %48 = call i64 @read_int_array(i64 %44, ptr %45, i64 %47)
+    store i64 %48, ptr %8
+    %49 = load i64, ptr %8
+    %50 = load i64, ptr %6
+    %51 = load ptr, ptr %1
+    %52 = load i64, ptr %8
+    %53 = getelementptr inbounds i64, ptr %51, i64 %52
+    %54 = load i64, ptr %0
+    %55 = call i64 @read_int_array(i64 %50, ptr %53, i64 %54)
+    %56 = add nsw i64 %49, %55
+    store i64 %56, ptr %8
+    %57 = load double, ptr %7
+    %58 = call double @pc_time()
+    %59 = fadd double %57, %58
+    store double %59, ptr %7
+    %60 = load i64, ptr %6
+    call void @close_file(i64 %60)
+    %61 = load i64, ptr %8
+    call void @printint(i64 %61)
+    %62 = load ptr, ptr %1
+    %63 = load i64, ptr %8
+    %64 = call i64 @reduce_sum_int(ptr %62, i64 %63)
+    call void @printint(i64 %64)
+    %65 = load double, ptr %7
+    %66 = fmul double %65, 1000.000000
+    call void @printfloat(double %66)
+    store i64 0, ptr %3
+    br label %L4
+L4:
+    %67 = load i64, ptr %3
+    %68 = load i64, ptr %0
+    %69 = icmp slt i64 %67, %68
+    br i1 %69, label %L5, label %L6
+L5:
+    %70 = load ptr, ptr %1
+    %71 = load i64, ptr %3
+    %72 = getelementptr inbounds i64, ptr %70, i64 %71
+    %73 = load i64, ptr %72
+    %74 = sitofp i64 %73 to double
+    %75 = fdiv double %74, 8.000000
+    %76 = load ptr, ptr %2
+    %77 = load i64, ptr %3
+    %78 = getelementptr inbounds double, ptr %76, i64 %77
+    store double %75, ptr %78
+    %79 = load i64, ptr %3
+    %80 = add nsw i64 %79, 1
+    store i64 %80, ptr %3
+    br label %L4
+L6:
+    %81 = load ptr, ptr %2
+    %82 = load i64, ptr %0
+    %83 = call double @reduce_sum_float(ptr %81, i64 %82)
+    store double %83, ptr %9
+    %84 = call i64 @open_file(ptr @path, i1 1)
+    store i64 %84, ptr %5
+    %85 = load i64, ptr %5
+    %86 = load ptr, ptr %2
+    %87 = load i64, ptr %0
+    call void @write_float_array(i64 %85, ptr %86, i64 %87, i64 32)
+    %88 = load i64, ptr %5
+    call void @close_file(i64 %88)
+    %89 = call i64 @open_file(ptr @path, i1 0)
+    store i64 %89, ptr %6
+    %90 = call double @pc_time()
+    %91 = fneg double %90
+    store double %91, ptr %7
+    %92 = load i64, ptr %6
+    %93 = load ptr, ptr %2
+    %94 = load i64, ptr %0
+    %95 = call i64 @read_float_array(i64 %92, ptr %93, i64 %94)
+    store i64 %95, ptr %8
+    %96 = load double, ptr %7
+    %97 = call double @pc_time()
+    %98 = fadd double %96, %97
+    store double %98, ptr %7
+    %99 = load i64, ptr %6
+    call void @close_file(i64 %99)
+    %100 = load i64, ptr %8
+    call void @printint(i64 %100)
+    %101 = alloca i64
+    %102 = load ptr, ptr %2
+    %103 = load i64, ptr %8
+    %104 = call double @reduce_sum_float(ptr %102, i64 %103)
+    %105 = load double, ptr %9
+    %106 = fcmp oeq double %104, %105
+    br i1 %106, label %L7, label %L8
+L7:
+    store i64 1, ptr %101
+    br label %L9
+L8:
+    store i64 0, ptr %101
+    br label %L9
+L9:
+    %107 = load i64, ptr %101
+    call void @printint(i64 %107)
+    %108 = load double, ptr %7
+    %109 = fmul double %108, 1000.000000
+    call void @printfloat(double %109)
+    %110 = load ptr, ptr %2
+    call void @dealloc(ptr %110)
+    %111 = load ptr, ptr %1
+    call void @dealloc(ptr %111)
+    ret i64 0
+}
@@ -0,0 +1,262 @@
+@path = unnamed_addr constant [12 x i8] [i8 109, i8 97, i8 112, i8 102, i8 105, i8 108, i8 101, i8 46, i8 116, i8 120, i8 116, i8 0], align 1
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @parse({ ptr, i64 } %0) readonly nounwind norecurse {
+L0:
+    %1 = alloca { ptr, i64 }
+    store { ptr, i64 } %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = alloca i64
+    %6 = extractvalue { ptr, i64 } %0, 1
+    %7 = icmp sge i64 %6, 0
+    call void @llvm.assume(i1 %7)
+    store i64 0, ptr %2
+    store i64 0, ptr %3
+    store i64 0, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %8 = load i64, ptr %5
+    %9 = load { ptr, i64 }, ptr %1
+    %10 = extractvalue { ptr, i64 } %9, 1
+    %11 = icmp slt i64 %8, %10
+    br i1 %11, label %L2, label %L3
+L2:
+    %12 = load { ptr, i64 }, ptr %1
+    %13 = load i64, ptr %5
+    %14 = extractvalue { ptr, i64 } %12, 0
+    %15 = getelementptr inbounds i8, ptr %14, i64 %13
+    %16 = load i8, ptr %15
+    %17 = zext i8 %16 to i64
+    store i64 %17, ptr %4
+    %18 = load i64, ptr %4
+    %19 = icmp ne i64 %18, 10
+    br i1 %19, label %L4, label %L5
+L4:
+    %20 = load i64, ptr %3
+    %21 = mul nsw i64 %20, 10
+    %22 = load i64, ptr %4
+    %23 = add nsw i64 %21, %22
+    %24 = sub nsw i64 %23, 48
+    store i64 %24, ptr %3
+    br label %L6
+L5:
+    br label %L6
+L6:
+    %25 = load i64, ptr %4
+    %26 = icmp eq i64 %25, 10
+    br i1 %26, label %L7, label %L8
+L7:
+    %27 = load i64, ptr %2
+    %28 = load i64, ptr %3
+    %29 = add nsw i64 %27, %28
+    store i64 %29, ptr %2
+    store i64 0, ptr %3
+    br label %L9
+L8:
+    br label %L9
+L9:
+    %30 = load i64, ptr %5
+    %31 = add nsw i64 %30, 1
+    store i64 %31, ptr %5
+    br label %L1
+L3:
+    %32 = load i64, ptr %2
+    ret i64 %32
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca double
+    %5 = alloca { ptr, i64 }
+    %6 = alloca { ptr, i64 }
+    store i64 5000000, ptr %0
+    %7 = load i64, ptr %0
+    %8 = mul nsw i64 8, %7
+    %9 = call ptr @alloc(i64 %8)
+    store ptr %9, ptr %1
+    store i64 0, ptr %2
+    br label %L1
+L1:
+    %10 = load i64, ptr %2
+    %11 = load i64, ptr %0
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load i64, ptr %2
+    %14 = load ptr, ptr %1
+    %15 = load i64, ptr %2
+    %16 = getelementptr inbounds i64, ptr %14, i64 %15
+    store i64 %13, ptr %16
+    %17 = load i64, ptr %2
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %2
+    br label %L1
+L3:
+    %19 = call i64 @open_file(ptr @path, i1 1)
+    store i64 %19, ptr %3
+    %20 = load i64, ptr %3
+    %21 = load ptr, ptr %1
+    %22 = load i64, ptr %0
+    call void @write_int_array(i64 %20, ptr %21, i64 %22, i64 10)
+    %23 = load i64, ptr %3
+    call void @close_file(i64 %23)
+    %24 = load ptr, ptr %1
+    call void @dealloc(ptr %24)
+    %25 = call double @pc_time()
+    %26 = fneg double %25
+    store double %26, ptr %4
+    %27 = call { ptr, i64 } @map_file(ptr @path, i1 0)
+    store { ptr, i64 } %27, ptr %5
+    %28 = load { ptr, i64 }, ptr %5
+    call void @map_advise({ ptr, i64 } %28, i64 1)
+    %29 = load { ptr, i64 }, ptr %5
+    %30 = extractvalue { ptr, i64 } %29, 1
+    call void @printint(i64 %30)
+    %31 = load { ptr, i64 }, ptr %5
+    %32 = load { ptr, i64 }, ptr %5
+    %33 = extractvalue { ptr, i64 } %32, 1
+    %34 = sub nsw i64 %33, 1
+    %35 = extractvalue { ptr, i64 } %31, 0
+    %36 = extractvalue { ptr, i64 } %31, 1
+    %37 = getelementptr inbounds i8, ptr %35, i64 0
+    %38 = sub i64 %34, 0
+    %39 = insertvalue { ptr, i64 } undef, ptr %37, 0
+    %40 = insertvalue { ptr, i64 } %39, i64 %38, 1
+    %41 = call i64 @parse({ ptr, i64 } %40)
+    call void @printint(i64 %41)
+    %42 = load { ptr, i64 }, ptr %5
+    call void @unmap_file({ ptr, i64 } %42)
+    %43 = load double, ptr %4
+    %44 = call double @pc_time()
+    %45 = fadd double %43, %44
+    store double %45, ptr %4
+    %46 = load double, ptr %4
+    %47 = fmul double %46, 1000.000000
+    call void @printfloat(double %47)
+    %48 = call { ptr, i64 } @map_file(ptr @path, i1 1)
+    store { ptr, i64 } %48, ptr %6
+    store i64 0, ptr %2
+    br label %L4
+L4:
+    %49 = load i64, ptr %2
+    %50 = load { ptr, i64 }, ptr %6
+    %51 = extractvalue { ptr, i64 } %50, 1
+    %52 = icmp slt i64 %49, %51
+    br i1 %52, label %L5, label %L6
+L5:
+    %53 = load { ptr, i64 }, ptr %6
+    %54 = load i64, ptr %2
+    %55 = extractvalue { ptr, i64 } %53, 0
+    %56 = getelementptr inbounds i8, ptr %55, i64 %54
+    %57 = load i8, ptr %56
+    %58 = icmp eq i8 %57, 57
+    br i1 %58, label %L7, label %L8
+L7:
+    %59 = load { ptr, i64 }, ptr %6
+    %60 = load i64, ptr %2
+    %61 = extractvalue { ptr, i64 } %59, 0
+    %62 = getelementptr inbounds i8, ptr %61, i64 %60
+    store i8 56, ptr %62
+    br label %L9
+L8:
+    br label %L9
+L9:
+    %63 = load i64, ptr %2
+    %64 = add nsw i64 %63, 1
+    store i64 %64, ptr %2
+    br label %L4
+L6:
+    %65 = load { ptr, i64 }, ptr %6
+    %66 = extractvalue { ptr, i64 } %65, 0
+    %67 = extractvalue { ptr, i64 } %65, 1
+    %68 = getelementptr inbounds i8, ptr %66, i64 0
+    %69 = sub i64 4096, 0
+    %70 = insertvalue { ptr, i64 } undef, ptr %68, 0
+    %71 = insertvalue { ptr, i64 } %70, i64 %69, 1
+    call void @sync_file({ ptr, i64 } %71)
+    %72 = load { ptr, i64 }, ptr %6
+    call void @sync_file({ ptr, i64 } %72)
+    %73 = load { ptr, i64 }, ptr %6
+    call void @unmap_file({ ptr, i64 } %73)
+    %74 = call { ptr, i64 } @map_file(ptr @path, i1 0)
+    store { ptr, i64 } %74, ptr %5
+    %75 = load { ptr, i64 }, ptr %5
+    %76 = load { ptr, i64 }, ptr %5
+    %77 = extractvalue { ptr, i64 } %76, 1
+    %78 = sub nsw i64 %77, 1
+    %79 = extractvalue { ptr, i64 } %75, 0
+    %80 = extractvalue { ptr, i64 } %75, 1
+    %81 = getelementptr inbounds i8, ptr %79, i64 0
+    %82 = sub i64 %78, 0
+    %83 = insertvalue { ptr, i64 } undef, ptr %81, 0
+    %84 = insertvalue { ptr, i64 } %83, i64 %82, 1
+    %85 = call i64 @parse({ ptr, i64 } %84)
+    call void @printint(i64 %85)
+    %86 = load { ptr, i64 }, ptr %5
+    call void @unmap_file({ ptr, i64 } %86)
+    ret i64 0
+}
+declare void @llvm.assume(i1 noundef)
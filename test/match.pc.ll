@@ -0,0 +1,354 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @eval(ptr %0, i64 %1) nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca ptr
+    %5 = alloca i64
+    %6 = alloca i64
+    %7 = alloca i8
+    %8 = alloca i64
+    %9 = load i64, ptr %3
+    %10 = mul nsw i64 8, %9
+    %11 = call ptr @alloc(i64 %10)
+    store ptr %11, ptr %4
+    store i64 0, ptr %5
+    store i64 0, ptr %6
+    br label %L1
+L1:
+    %12 = load i64, ptr %6
+    %13 = load i64, ptr %3
+    %14 = icmp slt i64 %12, %13
+    br i1 %14, label %L2, label %L3
+L2:
+    %15 = load ptr, ptr %2
+    %16 = load i64, ptr %6
+    %17 = getelementptr inbounds i8, ptr %15, i64 %16
+    %18 = load i8, ptr %17
+    store i8 %18, ptr %7
+    %19 = alloca i64
+    %20 = load i8, ptr %7
+    switch i8 %20, label %L9 [
+        i8 0, label %L5
+        i8 1, label %L6
+        i8 2, label %L7
+        i8 3, label %L8
+        i8 4, label %L8
+        i8 5, label %L8
+    ]
+L5:
+    %21 = load ptr, ptr %4
+    %22 = load i64, ptr %5
+    %23 = sub nsw i64 %22, 2
+    %24 = getelementptr inbounds i64, ptr %21, i64 %23
+    %25 = load i64, ptr %24
+    %26 = load ptr, ptr %4
+    %27 = load i64, ptr %5
+    %28 = sub nsw i64 %27, 1
+    %29 = getelementptr inbounds i64, ptr %26, i64 %28
+    %30 = load i64, ptr %29
+    %31 = add nsw i64 %25, %30
+    %32 = load ptr, ptr %4
+    %33 = load i64, ptr %5
+    %34 = sub nsw i64 %33, 2
+    %35 = getelementptr inbounds i64, ptr %32, i64 %34
+    store i64 %31, ptr %35
+    %36 = load i64, ptr %5
+    %37 = add nsw i64 %36, -1
+    store i64 %37, ptr %5
+    store i64 %37, ptr %19
+    br label %L4
+L6:
+    %38 = load ptr, ptr %4
+    %39 = load i64, ptr %5
+    %40 = sub nsw i64 %39, 2
+    %41 = getelementptr inbounds i64, ptr %38, i64 %40
+    %42 = load i64, ptr %41
+    %43 = load ptr, ptr %4
+    %44 = load i64, ptr %5
+    %45 = sub nsw i64 %44, 1
+    %46 = getelementptr inbounds i64, ptr %43, i64 %45
+    %47 = load i64, ptr %46
+    %48 = sub nsw i64 %42, %47
+    %49 = load ptr, ptr %4
+    %50 = load i64, ptr %5
+    %51 = sub nsw i64 %50, 2
+    %52 = getelementptr inbounds i64, ptr %49, i64 %51
+    store i64 %48, ptr %52
+    %53 = load i64, ptr %5
+    %54 = add nsw i64 %53, -1
+    store i64 %54, ptr %5
+    store i64 %54, ptr %19
+    br label %L4
+L7:
+    %55 = load ptr, ptr %4
+    %56 = load i64, ptr %5
+    %57 = sub nsw i64 %56, 2
+    %58 = getelementptr inbounds i64, ptr %55, i64 %57
+    %59 = load i64, ptr %58
+    %60 = load ptr, ptr %4
+    %61 = load i64, ptr %5
+    %62 = sub nsw i64 %61, 1
+    %63 = getelementptr inbounds i64, ptr %60, i64 %62
+    %64 = load i64, ptr %63
+    %65 = mul nsw i64 %59, %64
+    %66 = load ptr, ptr %4
+    %67 = load i64, ptr %5
+    %68 = sub nsw i64 %67, 2
+    %69 = getelementptr inbounds i64, ptr %66, i64 %68
+    store i64 %65, ptr %69
+    %70 = load i64, ptr %5
+    %71 = add nsw i64 %70, -1
+    store i64 %71, ptr %5
+    store i64 %71, ptr %19
+    br label %L4
+L8:
+    %72 = load i8, ptr %7
+    %73 = sub nsw i8 %72, 2
+    %74 = sext i8 %73 to i64
+    %75 = load ptr, ptr %4
+    %76 = load i64, ptr %5
+    %77 = getelementptr inbounds i64, ptr %75, i64 %76
+    store i64 %74, ptr %77
+    %78 = load i64, ptr %5
+    %79 = add nsw i64 %78, 1
+    store i64 %79, ptr %5
+    store i64 %79, ptr %19
+    br label %L4
+L9:
+    %80 = load i8, ptr %7
+    %81 = sext i8 %80 to i64
+    %82 = mul nsw i64 %81, 10
+    %83 = load ptr, ptr %4
+    %84 = load i64, ptr %5
+    %85 = getelementptr inbounds i64, ptr %83, i64 %84
+    store i64 %82, ptr %85
+    %86 = load i64, ptr %5
+    %87 = add nsw i64 %86, 1
+    store i64 %87, ptr %5
+    store i64 %87, ptr %19
+    br label %L4
+L4:
+    %88 = load i64, ptr %19
+    %89 = load i64, ptr %6
+    %90 = add nsw i64 %89, 1
+    store i64 %90, ptr %6
+    br label %L1
+L3:
+    %91 = load ptr, ptr %4
+    %92 = getelementptr inbounds i64, ptr %91, i64 0
+    %93 = load i64, ptr %92
+    store i64 %93, ptr %8
+    %94 = load ptr, ptr %4
+    call void @dealloc(ptr %94)
+    %95 = load i64, ptr %8
+    ret i64 %95
+}
+define i64 @days(i64 %0, i1 %1) readnone nounwind willreturn norecurse {
+L0:
+    %2 = alloca i64
+    store i64 %0, ptr %2
+    %3 = alloca i1
+    store i1 %1, ptr %3
+    %4 = alloca i64
+    %5 = load i64, ptr %2
+    switch i64 %5, label %L4 [
+        i64 2, label %L2
+        i64 4, label %L3
+        i64 6, label %L3
+        i64 9, label %L3
+        i64 11, label %L3
+    ]
+L2:
+    %6 = alloca i64
+    %7 = load i1, ptr %3
+    switch i1 %7, label %L7 [
+        i1 1, label %L6
+        i1 0, label %L7
+    ]
+L6:
+    store i64 29, ptr %6
+    br label %L5
+L7:
+    store i64 28, ptr %6
+    br label %L5
+L5:
+    %8 = load i64, ptr %6
+    store i64 %8, ptr %4
+    br label %L1
+L3:
+    store i64 30, ptr %4
+    br label %L1
+L4:
+    store i64 31, ptr %4
+    br label %L1
+L1:
+    %9 = load i64, ptr %4
+    ret i64 %9
+}
+define i64 @classify(i8 zeroext %0) readnone nounwind willreturn norecurse {
+L0:
+    %1 = alloca i8
+    store i8 %0, ptr %1
+    %2 = alloca i64
+    %3 = load i8, ptr %1
+    %4 = lshr i8 %3, 6
+    switch i8 %4, label %L4 [
+        i8 0, label %L2
+        i8 1, label %L3
+    ]
+L2:
+    store i64 1, ptr %2
+    br label %L1
+L3:
+    store i64 2, ptr %2
+    br label %L1
+L4:
+    store i64 3, ptr %2
+    br label %L1
+L1:
+    %5 = load i64, ptr %2
+    ret i64 %5
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca ptr
+    %1 = alloca i64
+    %2 = alloca i64
+    %3 = call ptr @alloc(i64 8)
+    store ptr %3, ptr %0
+    %4 = load ptr, ptr %0
+    %5 = getelementptr inbounds i8, ptr %4, i64 0
+    store i8 5, ptr %5
+    %6 = load ptr, ptr %0
+    %7 = getelementptr inbounds i8, ptr %6, i64 1
+    store i8 10, ptr %7
+    %8 = load ptr, ptr %0
+    %9 = getelementptr inbounds i8, ptr %8, i64 2
+    store i8 0, ptr %9
+    %10 = load ptr, ptr %0
+    %11 = getelementptr inbounds i8, ptr %10, i64 3
+    store i8 4, ptr %11
+    %12 = load ptr, ptr %0
+    %13 = getelementptr inbounds i8, ptr %12, i64 4
+    store i8 2, ptr %13
+    %14 = load ptr, ptr %0
+    %15 = getelementptr inbounds i8, ptr %14, i64 5
+    store i8 7, ptr %15
+    %16 = load ptr, ptr %0
+    %17 = getelementptr inbounds i8, ptr %16, i64 6
+    store i8 1, ptr %17
+    %18 = load ptr, ptr %0
+    %19 = call i64 @eval(ptr %18, i64 7)
+    call void @printint(i64 %19)
+    %20 = load ptr, ptr %0
+    call void @dealloc(ptr %20)
+    store i64 0, ptr %1
+    store i64 1, ptr %2
+    br label %L1
+L1:
+    %21 = load i64, ptr %2
+    %22 = icmp sle i64 %21, 12
+    br i1 %22, label %L2, label %L3
+L2:
+    %23 = load i64, ptr %1
+    %24 = load i64, ptr %2
+    %25 = call i64 @days(i64 %24, i1 0)
+    %26 = add nsw i64 %23, %25
+    store i64 %26, ptr %1
+    %27 = load i64, ptr %2
+    %28 = add nsw i64 %27, 1
+    store i64 %28, ptr %2
+    br label %L1
+L3:
+    %29 = load i64, ptr %1
+    call void @printint(i64 %29)
+    %30 = call i64 @days(i64 2, i1 1)
+    call void @printint(i64 %30)
+    %31 = call i64 @classify(i8 10)
+    %32 = mul nsw i64 %31, 100
+    %33 = call i64 @classify(i8 70)
+    %34 = mul nsw i64 %33, 10
+    %35 = add nsw i64 %32, %34
+    %36 = call i64 @classify(i8 200)
+    %37 = add nsw i64 %35, %36
+    call void @printint(i64 %37)
+    %38 = alloca i64
+    switch i64 3, label %L7 [
+        i64 1, label %L5
+        i64 3, label %L6
+    ]
+L5:
+    store i64 10, ptr %38
+    br label %L4
+L6:
+    store i64 30, ptr %38
+    br label %L4
+L7:
+    store i64 0, ptr %38
+    br label %L4
+L4:
+    %39 = load i64, ptr %38
+    call void @printint(i64 %39)
+    ret i64 0
+}
@@ -0,0 +1,21 @@
+@page_size = global i64 4096
+@cache_line = global i64 64
+@buffer_size = global i64 1024
+@scale = global float 0x3FE0000000000000
+@verbose = global i1 0
+define i64 @round_up(i64 %0, i64 %1) readnone nounwind willreturn norecurse {
+L0:
+    %2 = alloca i64
+    store i64 %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = load i64, ptr %2
+    %5 = load i64, ptr %3
+    %6 = add nsw i64 %4, %5
+    %7 = sub nsw i64 %6, 1
+    %8 = load i64, ptr %3
+    %9 = sdiv i64 %7, %8
+    %10 = load i64, ptr %3
+    %11 = mul nsw i64 %9, %10
+    ret i64 %11
+}
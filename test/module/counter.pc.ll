@@ -0,0 +1,9 @@
+@counter = global i64 0
+define i64 @bump() nounwind willreturn norecurse {
+L0:
+    %0 = load i64, ptr @counter
+    %1 = add nsw i64 %0, 1
+    store i64 %1, ptr @counter
+    %2 = load i64, ptr @counter
+    ret i64 %2
+}
@@ -0,0 +1,239 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i32 @checksum(ptr %0, i64 %1) readonly nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i32
+    %5 = alloca i64
+    store i32 0, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %6 = load i64, ptr %5
+    %7 = load i64, ptr %3
+    %8 = icmp slt i64 %6, %7
+    br i1 %8, label %L2, label %L3
+L2:
+    %9 = load i32, ptr %4
+    %10 = mul i32 %9, 31
+    %11 = load ptr, ptr %2
+    %12 = load i64, ptr %5
+    %13 = getelementptr inbounds i8, ptr %11, i64 %12
+    %14 = load i8, ptr %13
+    %15 = zext i8 %14 to i32
+    %16 = add i32 %10, %15
+    store i32 %16, ptr %4
+    %17 = load i64, ptr %5
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %5
+    br label %L1
+L3:
+    %19 = load i32, ptr %4
+    ret i32 %19
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca ptr
+    %1 = alloca i64
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca ptr
+    %5 = mul nsw i64 1, 8
+    %6 = call ptr @alloc(i64 %5)
+    store ptr %6, ptr %0
+    store i64 0, ptr %1
+    br label %L1
+L1:
+    %7 = load i64, ptr %1
+    %8 = icmp slt i64 %7, 8
+    br i1 %8, label %L2, label %L3
+L2:
+    %9 = load i64, ptr %1
+    %10 = mul nsw i64 %9, 40
+    %11 = trunc i64 %10 to i8
+    %12 = load ptr, ptr %0
+    %13 = load i64, ptr %1
+    %14 = getelementptr inbounds i8, ptr %12, i64 %13
+    store i8 %11, ptr %14
+    %15 = load i64, ptr %1
+    %16 = add nsw i64 %15, 1
+    store i64 %16, ptr %1
+    br label %L1
+L3:
+    %17 = load ptr, ptr %0
+    %18 = call i32 @checksum(ptr %17, i64 8)
+    %19 = zext i32 %18 to i64
+    call void @printint(i64 %19)
+    %20 = load ptr, ptr %0
+    %21 = getelementptr inbounds i8, ptr %20, i64 7
+    %22 = load ptr, ptr %0
+    %23 = getelementptr inbounds i8, ptr %22, i64 1
+    %24 = ptrtoint ptr %21 to i64
+    %25 = ptrtoint ptr %23 to i64
+    %26 = sub i64 %24, %25
+    %27 = sdiv i64 %26, 1
+    call void @printint(i64 %27)
+    %28 = load ptr, ptr %0
+    %29 = getelementptr inbounds i8, ptr %28, i64 6
+    %30 = load i8, ptr %29
+    %31 = zext i8 %30 to i64
+    call void @printint(i64 %31)
+    %32 = load ptr, ptr %0
+    %33 = getelementptr inbounds i8, ptr %32, i64 6
+    %34 = load i8, ptr %33
+    %35 = sext i8 %34 to i64
+    call void @printint(i64 %35)
+    %36 = mul nsw i64 4, 4
+    %37 = call ptr @alloc(i64 %36)
+    store ptr %37, ptr %2
+    %38 = load ptr, ptr %2
+    %39 = getelementptr inbounds i32, ptr %38, i64 0
+    store i32 -7, ptr %39
+    %40 = load ptr, ptr %2
+    %41 = getelementptr inbounds i32, ptr %40, i64 0
+    %42 = load i32, ptr %41
+    %43 = sdiv i32 %42, 2
+    %44 = load ptr, ptr %2
+    %45 = getelementptr inbounds i32, ptr %44, i64 1
+    store i32 %43, ptr %45
+    %46 = load ptr, ptr %2
+    %47 = getelementptr inbounds i32, ptr %46, i64 0
+    %48 = load i32, ptr %47
+    %49 = ashr i32 %48, 1
+    %50 = load ptr, ptr %2
+    %51 = getelementptr inbounds i32, ptr %50, i64 2
+    store i32 %49, ptr %51
+    %52 = load ptr, ptr %2
+    %53 = getelementptr inbounds i32, ptr %52, i64 0
+    %54 = load i32, ptr %53
+    %55 = lshr i32 %54, 28
+    %56 = load ptr, ptr %2
+    %57 = getelementptr inbounds i32, ptr %56, i64 3
+    store i32 %55, ptr %57
+    %58 = load ptr, ptr %2
+    call void @print_i32_array(ptr %58, i64 4)
+    store i64 -1, ptr %3
+    %59 = load i64, ptr %3
+    call void @printuint(i64 %59)
+    %60 = load i64, ptr %3
+    %61 = udiv i64 %60, 3
+    call void @printuint(i64 %61)
+    %62 = alloca i64
+    %63 = load i64, ptr %3
+    %64 = icmp ugt i64 %63, 1
+    br i1 %64, label %L4, label %L5
+L4:
+    store i64 1, ptr %62
+    br label %L6
+L5:
+    store i64 0, ptr %62
+    br label %L6
+L6:
+    %65 = load i64, ptr %62
+    call void @printint(i64 %65)
+    %66 = alloca i64
+    %67 = icmp sgt i64 -1, 1
+    br i1 %67, label %L7, label %L8
+L7:
+    store i64 1, ptr %66
+    br label %L9
+L8:
+    store i64 0, ptr %66
+    br label %L9
+L9:
+    %68 = load i64, ptr %66
+    call void @printint(i64 %68)
+    %69 = mul nsw i64 4, 3
+    %70 = call ptr @alloc(i64 %69)
+    store ptr %70, ptr %4
+    %71 = load ptr, ptr %4
+    %72 = getelementptr inbounds float, ptr %71, i64 0
+    store float 0x3FB99999A0000000, ptr %72
+    %73 = load ptr, ptr %4
+    %74 = getelementptr inbounds float, ptr %73, i64 0
+    %75 = load float, ptr %74
+    %76 = fmul float %75, 0x4008000000000000
+    %77 = load ptr, ptr %4
+    %78 = getelementptr inbounds float, ptr %77, i64 1
+    store float %76, ptr %78
+    %79 = load ptr, ptr %4
+    %80 = getelementptr inbounds float, ptr %79, i64 1
+    %81 = load float, ptr %80
+    %82 = fpext float %81 to double
+    %83 = fmul double %82, 2.000000
+    %84 = fptrunc double %83 to float
+    %85 = load ptr, ptr %4
+    %86 = getelementptr inbounds float, ptr %85, i64 2
+    store float %84, ptr %86
+    %87 = load ptr, ptr %4
+    call void @print_f32_array(ptr %87, i64 3)
+    %88 = fpext float 0x3FB99999A0000000 to double
+    call void @printfloat(double %88)
+    %89 = load ptr, ptr %4
+    call void @dealloc(ptr %89)
+    %90 = load ptr, ptr %2
+    call void @dealloc(ptr %90)
+    %91 = load ptr, ptr %0
+    call void @dealloc(ptr %91)
+    ret i64 0
+}
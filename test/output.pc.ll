@@ -0,0 +1,154 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca double
+    call void @printint(i64 0)
+    %5 = sub nsw i64 -9223372036854775807, 1
+    call void @printint(i64 %5)
+    %6 = sub i64 0, 1
+    call void @printuint(i64 %6)
+    call void @printfloat(double 0x3EA0C6F7A0B5ED8D)
+    %7 = fneg double 0.000000
+    call void @printfloat(double %7)
+    call void @printfloat(double 0x3E90C6F7A0B5ED8D)
+    call void @printfloat(double 1000000000000000052504760255204420248704468581108159154915854115511802457988908195786371375080447864043704443832883878176942523235360430575644792184786706982848387200926575803737830233794788090059368953234970799945081119038967640880074652742780142494579258788820056842838115669472196386865459400540160.000000)
+    call void @printfloat(double 0x40FE240C9FCB923A)
+    store i64 1000000, ptr %0
+    %8 = load i64, ptr %0
+    %9 = mul nsw i64 8, %8
+    %10 = call ptr @alloc(i64 %9)
+    store ptr %10, ptr %1
+    %11 = load i64, ptr %0
+    %12 = mul nsw i64 8, %11
+    %13 = call ptr @alloc(i64 %12)
+    store ptr %13, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %14 = load i64, ptr %3
+    %15 = load i64, ptr %0
+    %16 = icmp slt i64 %14, %15
+    br i1 %16, label %L2, label %L3
+L2:
+    %17 = load i64, ptr %3
+    %18 = mul nsw i64 %17, 7919
+    %19 = load i64, ptr %0
+    %20 = sub nsw i64 %18, %19
+    %21 = load ptr, ptr %1
+    %22 = load i64, ptr %3
+    %23 = getelementptr inbounds i64, ptr %21, i64 %22
+    store i64 %20, ptr %23
+    %24 = load ptr, ptr %1
+    %25 = load i64, ptr %3
+    %26 = getelementptr inbounds i64, ptr %24, i64 %25
+    %27 = load i64, ptr %26
+    %28 = sitofp i64 %27 to double
+    %29 = fdiv double %28, 64.000000
+    %30 = load ptr, ptr %2
+    %31 = load i64, ptr %3
+    %32 = getelementptr inbounds double, ptr %30, i64 %31
+    store double %29, ptr %32
+    %33 = load i64, ptr %3
+    %34 = add nsw i64 %33, 1
+    store i64 %34, ptr %3
+    br label %L1
+L3:
+    %35 = load ptr, ptr %1
+    call void @write_int_array(i64 1, ptr %35, i64 8, i64 44)
+    %36 = load ptr, ptr %2
+    call void @write_float_array(i64 1, ptr %36, i64 4, i64 32)
+    call void @flush_output()
+    %37 = call double @pc_time()
+    %38 = fneg double %37
+    store double %38, ptr %4
+    %39 = load ptr, ptr %1
+    %40 = load i64, ptr %0
+    call void @write_int_array(i64 -1, ptr %39, i64 %40, i64 10)
+    %41 = load double, ptr %4
+    %42 = call double @pc_time()
+    %43 = fadd double %41, %42
+    store double %43, ptr %4
+    %44 = load double, ptr %4
+    %45 = fmul double %44, 1000.000000
+    call void @printfloat(double %45)
+    %46 = call double @pc_time()
+    %47 = fneg double %46
+    store double %47, ptr %4
+    %48 = load ptr, ptr %2
+    %49 = load i64, ptr %0
+    call void @write_float_array(i64 -1, ptr %48, i64 %49, i64 10)
+    %50 = load double, ptr %4
+    %51 = call double @pc_time()
+    %52 = fadd double %50, %51
+    store double %52, ptr %4
+    %53 = load double, ptr %4
+    %54 = fmul double %53, 1000.000000
+    call void @printfloat(double %54)
+    %55 = load ptr, ptr %2
+    call void @dealloc(ptr %55)
+    %56 = load ptr, ptr %1
+    call void @dealloc(ptr %56)
+    ret i64 0
+}
@@ -0,0 +1,348 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define ptr @square_sum(ptr %0, i64 %1, i64 %2) readonly nounwind norecurse {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca ptr
+    %7 = alloca i64
+    %8 = alloca i64
+    %9 = load ptr, ptr %3
+    store ptr %9, ptr %6
+    store i64 0, ptr %7
+    store i64 0, ptr %8
+    br label %L1
+L1:
+    %10 = load i64, ptr %8
+    %11 = load i64, ptr %5
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load i64, ptr %7
+    %14 = load ptr, ptr %6
+    %15 = load i64, ptr %4
+    %16 = load i64, ptr %8
+    %17 = add nsw i64 %15, %16
+    %18 = getelementptr inbounds i64, ptr %14, i64 %17
+    %19 = load i64, ptr %18
+    %20 = load ptr, ptr %6
+    %21 = load i64, ptr %4
+    %22 = load i64, ptr %8
+    %23 = add nsw i64 %21, %22
+    %24 = getelementptr inbounds i64, ptr %20, i64 %23
+    %25 = load i64, ptr %24
+    %26 = mul nsw i64 %19, %25
+    %27 = add nsw i64 %13, %26
+    store i64 %27, ptr %7
+    %28 = load i64, ptr %8
+    %29 = add nsw i64 %28, 1
+    store i64 %29, ptr %8
+    br label %L1
+L3:
+    %30 = load i64, ptr %7
+    %31 = inttoptr i64 %30 to ptr
+    ret ptr %31
+}
+define i64 @collect(ptr %0) nounwind norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = load ptr, ptr %1
+    store ptr %5, ptr %2
+    store i64 0, ptr %3
+    store i64 0, ptr %4
+    br label %L1
+L1:
+    %6 = load i64, ptr %4
+    %7 = load ptr, ptr %2
+    %8 = getelementptr inbounds i64, ptr %7, i64 -1
+    %9 = load i64, ptr %8
+    %10 = icmp slt i64 %6, %9
+    br i1 %10, label %L2, label %L3
+L2:
+    %11 = load i64, ptr %3
+    %12 = load ptr, ptr %2
+    %13 = load i64, ptr %4
+    %14 = getelementptr inbounds i64, ptr %12, i64 %13
+    %15 = load i64, ptr %14
+    %16 = add nsw i64 %11, %15
+    store i64 %16, ptr %3
+    %17 = load i64, ptr %4
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %4
+    br label %L1
+L3:
+    %19 = load ptr, ptr %1
+    %20 = sub i64 0, 1
+    %21 = getelementptr inbounds ptr, ptr %19, i64 %20
+    call void @dealloc(ptr %21)
+    %22 = load i64, ptr %3
+    ret i64 %22
+}
+define ptr @chunk_sum(ptr %0) readonly nounwind norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = load ptr, ptr %1
+    store ptr %5, ptr %2
+    store i64 0, ptr %3
+    %6 = load ptr, ptr %2
+    %7 = getelementptr inbounds i64, ptr %6, i64 0
+    %8 = load i64, ptr %7
+    store i64 %8, ptr %4
+    br label %L1
+L1:
+    %9 = load i64, ptr %4
+    %10 = load ptr, ptr %2
+    %11 = getelementptr inbounds i64, ptr %10, i64 1
+    %12 = load i64, ptr %11
+    %13 = icmp slt i64 %9, %12
+    br i1 %13, label %L2, label %L3
+L2:
+    %14 = load i64, ptr %3
+    %15 = load i64, ptr %4
+    %16 = add nsw i64 %14, %15
+    store i64 %16, ptr %3
+    %17 = load i64, ptr %4
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %4
+    br label %L1
+L3:
+    %19 = load i64, ptr %3
+    %20 = inttoptr i64 %19 to ptr
+    ret ptr %20
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = alloca double
+    %6 = alloca i64
+    %7 = alloca ptr
+    %8 = alloca ptr
+    %9 = alloca i64
+    %10 = alloca i64
+    store i64 64, ptr %0
+    %11 = load i64, ptr %0
+    %12 = mul nsw i64 8, %11
+    %13 = call ptr @alloc(i64 %12)
+    store ptr %13, ptr %1
+    store i64 0, ptr %2
+    br label %L1
+L1:
+    %14 = load i64, ptr %2
+    %15 = load i64, ptr %0
+    %16 = icmp slt i64 %14, %15
+    br i1 %16, label %L2, label %L3
+L2:
+    %17 = load i64, ptr %2
+    %18 = load ptr, ptr %1
+    %19 = load i64, ptr %2
+    %20 = getelementptr inbounds i64, ptr %18, i64 %19
+    store i64 %17, ptr %20
+    %21 = load i64, ptr %2
+    %22 = add nsw i64 %21, 1
+    store i64 %22, ptr %2
+    br label %L1
+L3:
+    %23 = load ptr, ptr %1
+    %24 = load i64, ptr %0
+    %25 = call ptr @parallel_for(ptr %23, i64 %24, ptr @square_sum)
+    %26 = call i64 @collect(ptr %25)
+    call void @printint(i64 %26)
+    store i64 10000, ptr %3
+    store i64 0, ptr %4
+    %27 = call double @pc_time()
+    %28 = fneg double %27
+    store double %28, ptr %5
+    store i64 0, ptr %2
+    br label %L4
+L4:
+    %29 = load i64, ptr %2
+    %30 = load i64, ptr %3
+    %31 = icmp slt i64 %29, %30
+    br i1 %31, label %L5, label %L6
+L5:
+    %32 = load i64, ptr %4
+    %33 = load ptr, ptr %1
+    %34 = load i64, ptr %0
+    %35 = call ptr @parallel_for(ptr %33, i64 %34, ptr @square_sum)
+    %36 = call i64 @collect(ptr %35)
+    %37 = add nsw i64 %32, %36
+    store i64 %37, ptr %4
+    %38 = load i64, ptr %2
+    %39 = add nsw i64 %38, 1
+    store i64 %39, ptr %2
+    br label %L4
+L6:
+    %40 = load double, ptr %5
+    %41 = call double @pc_time()
+    %42 = fadd double %40, %41
+    store double %42, ptr %5
+    %43 = load i64, ptr %4
+    call void @printint(i64 %43)
+    %44 = load double, ptr %5
+    %45 = fmul double %44, 1000000.000000
+    %46 = load i64, ptr %3
+    %47 = sitofp i64 %46 to double
+    %48 = fdiv double %45, %47
+    call void @printfloat(double %48)
+    %49 = call i64 @thread_count()
+    store i64 %49, ptr %6
+    %50 = load i64, ptr %6
+    %51 = mul nsw i64 8, %50
+    %52 = mul nsw i64 %51, 2
+    %53 = call ptr @alloc(i64 %52)
+    store ptr %53, ptr %7
+    %54 = load i64, ptr %6
+    %55 = mul nsw i64 8, %54
+    %56 = call ptr @alloc(i64 %55)
+    store ptr %56, ptr %8
+    store i64 1000000, ptr %9
+    store i64 0, ptr %2
+    br label %L7
+L7:
+    %57 = load i64, ptr %2
+    %58 = load i64, ptr %6
+    %59 = icmp slt i64 %57, %58
+    br i1 %59, label %L8, label %L9
+L8:
+    %60 = load i64, ptr %2
+    %61 = load i64, ptr %9
+    %62 = mul nsw i64 %60, %61
+    %63 = load i64, ptr %6
+    %64 = sdiv i64 %62, %63
+    %65 = load ptr, ptr %7
+    %66 = load i64, ptr %2
+    %67 = mul nsw i64 %66, 2
+    %68 = getelementptr inbounds i64, ptr %65, i64 %67
+    store i64 %64, ptr %68
+    %69 = load i64, ptr %2
+    %70 = add nsw i64 %69, 1
+    %71 = load i64, ptr %9
+    %72 = mul nsw i64 %70, %71
+    %73 = load i64, ptr %6
+    %74 = sdiv i64 %72, %73
+    %75 = load ptr, ptr %7
+    %76 = load i64, ptr %2
+    %77 = mul nsw i64 %76, 2
+    %78 = add nsw i64 %77, 1
+    %79 = getelementptr inbounds i64, ptr %75, i64 %78
+    store i64 %74, ptr %79
+    %80 = load ptr, ptr %7
+    %81 = load i64, ptr %2
+    %82 = mul nsw i64 %81, 2
+    %83 = getelementptr inbounds i64, ptr %80, i64 %82
+    %84 = call i64 @thread_create(ptr @chunk_sum, ptr %83)
+    %85 = load ptr, ptr %8
+    %86 = load i64, ptr %2
+    %87 = getelementptr inbounds i64, ptr %85, i64 %86
+    store i64 %84, ptr %87
+    %88 = load i64, ptr %2
+    %89 = add nsw i64 %88, 1
+    store i64 %89, ptr %2
+    br label %L7
+L9:
+    store i64 0, ptr %10
+    store i64 0, ptr %2
+    br label %L10
+L10:
+    %90 = load i64, ptr %2
+    %91 = load i64, ptr %6
+    %92 = icmp slt i64 %90, %91
+    br i1 %92, label %L11, label %L12
+L11:
+    %93 = load i64, ptr %10
+    %94 = load ptr, ptr %8
+    %95 = load i64, ptr %2
+    %96 = getelementptr inbounds i64, ptr %94, i64 %95
+    %97 = load i64, ptr %96
+    %98 = call ptr @thread_join(i64 %97)
+    %99 = ptrtoint ptr %98 to i64
+    %100 = add nsw i64 %93, %99
+    store i64 %100, ptr %10
+    %101 = load i64, ptr %2
+    %102 = add nsw i64 %101, 1
+    store i64 %102, ptr %2
+    br label %L10
+L12:
+    %103 = load i64, ptr %10
+    call void @printint(i64 %103)
+    %104 = load ptr, ptr %8
+    call void @dealloc(ptr %104)
+    %105 = load ptr, ptr %7
+    call void @dealloc(ptr %105)
+    %106 = load ptr, ptr %1
+    call void @dealloc(ptr %106)
+    ret i64 0
+}
@@ -0,0 +1,291 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @next(ptr %0) nounwind willreturn norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = load ptr, ptr %1
+    %3 = load i64, ptr %2
+    %4 = mul i64 %3, 6364136223846793005
+    %5 = add i64 %4, 1442695040888963407
+    %6 = load ptr, ptr %1
+    store i64 %5, ptr %6
+    %7 = load ptr, ptr %1
+    %8 = load i64, ptr %7
+    %9 = ashr i64 %8, 16
+    ret i64 %9
+}
+define i1 @less(ptr %0, ptr %1) readonly nounwind willreturn norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca ptr
+    store ptr %1, ptr %3
+    %4 = load ptr, ptr %2
+    %5 = load i64, ptr %4
+    %6 = load ptr, ptr %3
+    %7 = load i64, ptr %6
+    %8 = icmp slt i64 %5, %7
+    ret i1 %8
+}
+define i1 @greater(ptr %0, ptr %1) readonly nounwind willreturn norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca ptr
+    store ptr %1, ptr %3
+    %4 = load ptr, ptr %2
+    %5 = load i64, ptr %4
+    %6 = load ptr, ptr %3
+    %7 = load i64, ptr %6
+    %8 = icmp sgt i64 %5, %7
+    ret i1 %8
+}
+define i64 @inversions(ptr %0, i64 %1, ptr %2) {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca ptr
+    store ptr %2, ptr %5
+    %6 = alloca i64
+    %7 = alloca i64
+    store i64 0, ptr %6
+    store i64 1, ptr %7
+    br label %L1
+L1:
+    %8 = load i64, ptr %7
+    %9 = load i64, ptr %4
+    %10 = icmp slt i64 %8, %9
+    br i1 %10, label %L2, label %L3
+L2:
+    %11 = load ptr, ptr %5
+    %12 = load ptr, ptr %3
+    %13 = load i64, ptr %7
+    %14 = getelementptr inbounds i64, ptr %12, i64 %13
+    %15 = load ptr, ptr %3
+    %16 = load i64, ptr %7
+    %17 = getelementptr inbounds i64, ptr %15, i64 %16
+    %18 = sub i64 0, 1
+    %19 = getelementptr inbounds i64, ptr %17, i64 %18
+    %20 = call i1 %11(ptr %14, ptr %19)
+    br i1 %20, label %L4, label %L5
+L4:
+    %21 = load i64, ptr %6
+    %22 = add nsw i64 %21, 1
+    store i64 %22, ptr %6
+    br label %L6
+L5:
+    br label %L6
+L6:
+    %23 = load i64, ptr %7
+    %24 = add nsw i64 %23, 1
+    store i64 %24, ptr %7
+    br label %L1
+L3:
+    %25 = load i64, ptr %6
+    ret i64 %25
+}
+define i64 @main() {
+L0:
+    %0 = alloca ptr
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = alloca ptr
+    %6 = alloca double
+    %7 = mul nsw i64 8, 10
+    %8 = call ptr @alloc(i64 %7)
+    store ptr %8, ptr %0
+    %9 = mul nsw i64 8, 10
+    %10 = call ptr @alloc(i64 %9)
+    store ptr %10, ptr %1
+    store i64 42, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %11 = load i64, ptr %3
+    %12 = icmp slt i64 %11, 10
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = call i64 @next(ptr %2)
+    %14 = srem i64 %13, 100
+    %15 = load ptr, ptr %0
+    %16 = load i64, ptr %3
+    %17 = getelementptr inbounds i64, ptr %15, i64 %16
+    store i64 %14, ptr %17
+    %18 = load ptr, ptr %0
+    %19 = load i64, ptr %3
+    %20 = getelementptr inbounds i64, ptr %18, i64 %19
+    %21 = load i64, ptr %20
+    %22 = sitofp i64 %21 to double
+    %23 = fdiv double %22, 8.000000
+    %24 = load ptr, ptr %1
+    %25 = load i64, ptr %3
+    %26 = getelementptr inbounds double, ptr %24, i64 %25
+    store double %23, ptr %26
+    %27 = load i64, ptr %3
+    %28 = add nsw i64 %27, 1
+    store i64 %28, ptr %3
+    br label %L1
+L3:
+    %29 = load ptr, ptr %0
+    call void @parallel_sort_int(ptr %29, i64 10)
+    %30 = load ptr, ptr %0
+    call void @print_int_array(ptr %30, i64 10)
+    %31 = load ptr, ptr %0
+    call void @parallel_sort(ptr %31, i64 8, i64 10, ptr @greater)
+    %32 = load ptr, ptr %0
+    call void @print_int_array(ptr %32, i64 10)
+    %33 = load ptr, ptr %1
+    call void @parallel_sort_float(ptr %33, i64 10)
+    %34 = load ptr, ptr %1
+    %35 = getelementptr inbounds double, ptr %34, i64 0
+    %36 = load double, ptr %35
+    call void @printfloat(double %36)
+    %37 = load ptr, ptr %1
+    %38 = getelementptr inbounds double, ptr %37, i64 9
+    %39 = load double, ptr %38
+    call void @printfloat(double %39)
+    %40 = load ptr, ptr %1
+    call void @dealloc(ptr %40)
+    %41 = load ptr, ptr %0
+    call void @dealloc(ptr %41)
+    store i64 1000000, ptr %4
+    %42 = load i64, ptr %4
+    %43 = mul nsw i64 8, %42
+    %44 = call ptr @alloc(i64 %43)
+    store ptr %44, ptr %5
+    store i64 0, ptr %3
+    br label %L4
+L4:
+    %45 = load i64, ptr %3
+    %46 = load i64, ptr %4
+    %47 = icmp slt i64 %45, %46
+    br i1 %47, label %L5, label %L6
+L5:
+    %48 = call i64 @next(ptr %2)
+    %49 = load ptr, ptr %5
+    %50 = load i64, ptr %3
+    %51 = getelementptr inbounds i64, ptr %49, i64 %50
+    store i64 %48, ptr %51
+    %52 = load i64, ptr %3
+    %53 = add nsw i64 %52, 1
+    store i64 %53, ptr %3
+    br label %L4
+L6:
+    %54 = call double @pc_time()
+    %55 = fneg double %54
+    store double %55, ptr %6
+    %56 = load ptr, ptr %5
+    %57 = load i64, ptr %4
+    call void @parallel_sort_int(ptr %56, i64 %57)
+    %58 = load double, ptr %6
+    %59 = call double @pc_time()
+    %60 = fadd double %58, %59
+    store double %60, ptr %6
+    %61 = load ptr, ptr %5
+    %62 = load i64, ptr %4
+    %63 = call i64 @inversions(ptr %61, i64 %62, ptr @less)
+    call void @printint(i64 %63)
+    %64 = load double, ptr %6
+    %65 = fmul double %64, 1000.000000
+    call void @printfloat(double %65)
+    store i64 0, ptr %3
+    br label %L7
+L7:
+    %66 = load i64, ptr %3
+    %67 = load i64, ptr %4
+    %68 = icmp slt i64 %66, %67
+    br i1 %68, label %L8, label %L9
+L8:
+    %69 = call i64 @next(ptr %2)
+    %70 = load ptr, ptr %5
+    %71 = load i64, ptr %3
+    %72 = getelementptr inbounds i64, ptr %70, i64 %71
+    store i64 %69, ptr %72
+    %73 = load i64, ptr %3
+    %74 = add nsw i64 %73, 1
+    store i64 %74, ptr %3
+    br label %L7
+L9:
+    %75 = call double @pc_time()
+    %76 = fneg double %75
+    store double %76, ptr %6
+    %77 = load ptr, ptr %5
+    %78 = load i64, ptr %4
+    call void @parallel_sort(ptr %77, i64 8, i64 %78, ptr @greater)
+    %79 = load double, ptr %6
+    %80 = call double @pc_time()
+    %81 = fadd double %79, %80
+    store double %81, ptr %6
+    %82 = load ptr, ptr %5
+    %83 = load i64, ptr %4
+    %84 = call i64 @inversions(ptr %82, i64 %83, ptr @greater)
+    call void @printint(i64 %84)
+    %85 = load double, ptr %6
+    %86 = fmul double %85, 1000.000000
+    call void @printfloat(double %86)
+    %87 = load ptr, ptr %5
+    call void @dealloc(ptr %87)
+    ret i64 0
+}
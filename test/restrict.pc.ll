@@ -0,0 +1,139 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define void @add_scaled(ptr noalias %0, ptr noalias %1, i64 %2, i64 %3) nounwind norecurse {
+L0:
+    %4 = alloca ptr
+    store ptr %0, ptr %4
+    %5 = alloca ptr
+    store ptr %1, ptr %5
+    %6 = alloca i64
+    store i64 %2, ptr %6
+    %7 = alloca i64
+    store i64 %3, ptr %7
+    %8 = alloca i64
+    store i64 0, ptr %8
+    br label %L1
+L1:
+    %9 = load i64, ptr %8
+    %10 = load i64, ptr %6
+    %11 = icmp slt i64 %9, %10
+    br i1 %11, label %L2, label %L3
+L2:
+    %12 = load ptr, ptr %4
+    %13 = load i64, ptr %8
+    %14 = getelementptr inbounds i64, ptr %12, i64 %13
+    %15 = load i64, ptr %14
+    %16 = load ptr, ptr %5
+    %17 = load i64, ptr %8
+    %18 = getelementptr inbounds i64, ptr %16, i64 %17
+    %19 = load i64, ptr %18
+    %20 = load i64, ptr %7
+    %21 = mul nsw i64 %19, %20
+    %22 = add nsw i64 %15, %21
+    %23 = load ptr, ptr %4
+    %24 = load i64, ptr %8
+    %25 = getelementptr inbounds i64, ptr %23, i64 %24
+    store i64 %22, ptr %25
+    %26 = load i64, ptr %8
+    %27 = add nsw i64 %26, 1
+    store i64 %27, ptr %8
+    br label %L1
+L3:
+    ret void
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca ptr
+    %1 = alloca i64
+    %2 = mul nsw i64 8, 16
+    %3 = call ptr @alloc(i64 %2)
+    store ptr %3, ptr %0
+    store i64 0, ptr %1
+    br label %L1
+L1:
+    %4 = load i64, ptr %1
+    %5 = icmp slt i64 %4, 16
+    br i1 %5, label %L2, label %L3
+L2:
+    %6 = load i64, ptr %1
+    %7 = load ptr, ptr %0
+    %8 = load i64, ptr %1
+    %9 = getelementptr inbounds i64, ptr %7, i64 %8
+    store i64 %6, ptr %9
+    %10 = load i64, ptr %1
+    %11 = add nsw i64 %10, 1
+    store i64 %11, ptr %1
+    br label %L1
+L3:
+    %12 = load ptr, ptr %0
+    %13 = load ptr, ptr %0
+    %14 = getelementptr inbounds i64, ptr %13, i64 8
+    call void @add_scaled(ptr %12, ptr %14, i64 8, i64 2)
+    %15 = load ptr, ptr %0
+    %16 = getelementptr inbounds i64, ptr %15, i64 8
+    %17 = load ptr, ptr %0
+    %18 = getelementptr inbounds i64, ptr %17, i64 0
+    call void @add_scaled(ptr %16, ptr %18, i64 8, i64 -1)
+    %19 = load ptr, ptr %0
+    call void @print_int_array(ptr %19, i64 16)
+    %20 = load ptr, ptr %0
+    call void @dealloc(ptr %20)
+    ret i64 0
+}
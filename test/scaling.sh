@@ -0,0 +1,15 @@
+# usage: ./scaling.sh [test.pc]
+# run a benchmark once for every worker count from 1 to $(nproc), after test.sh has built the compiler
+x=${1:-psort.pc}
+clang -emit-llvm -S ../lib/lib.c -o lib.ll &&
+../build/PorkchopLite $x -o $x.ll -l &&
+llvm-link -opaque-pointers $x.ll lib.ll -S -o $x.out.ll || exit 1
+
+for threads in $(seq 1 $(nproc)); do
+  echo "running" $x "with" $threads "threads"
+  PORKCHOP_THREADS=$threads lli -opaque-pointers $x.out.ll
+done
+
+# cleanup
+rm $x.out.ll
+rm lib.ll
@@ -0,0 +1,294 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @cost(i64 %0, i64 %1) readnone nounwind willreturn norecurse {
+L0:
+    %2 = alloca i64
+    store i64 %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i64
+    %5 = load i64, ptr %2
+    %6 = load i64, ptr %3
+    %7 = sdiv i64 %6, 16
+    %8 = icmp slt i64 %5, %7
+    br i1 %8, label %L1, label %L2
+L1:
+    store i64 2000, ptr %4
+    br label %L3
+L2:
+    store i64 20, ptr %4
+    br label %L3
+L3:
+    %9 = load i64, ptr %4
+    ret i64 %9
+}
+define ptr @skewed(ptr %0, i64 %1, i64 %2) readonly nounwind norecurse {
+L0:
+    %3 = alloca ptr
+    store ptr %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca i64
+    %7 = alloca i64
+    %8 = alloca i64
+    %9 = alloca i64
+    %10 = alloca i64
+    %11 = load ptr, ptr %3
+    %12 = getelementptr inbounds i64, ptr %11, i64 0
+    %13 = load i64, ptr %12
+    store i64 %13, ptr %6
+    store i64 0, ptr %7
+    %14 = load i64, ptr %4
+    store i64 %14, ptr %8
+    br label %L1
+L1:
+    %15 = load i64, ptr %8
+    %16 = load i64, ptr %4
+    %17 = load i64, ptr %5
+    %18 = add nsw i64 %16, %17
+    %19 = icmp slt i64 %15, %18
+    br i1 %19, label %L2, label %L3
+L2:
+    %20 = load i64, ptr %8
+    store i64 %20, ptr %9
+    store i64 0, ptr %10
+    br label %L4
+L4:
+    %21 = load i64, ptr %10
+    %22 = load i64, ptr %8
+    %23 = load i64, ptr %6
+    %24 = call i64 @cost(i64 %22, i64 %23)
+    %25 = icmp slt i64 %21, %24
+    br i1 %25, label %L5, label %L6
+L5:
+    %26 = load i64, ptr %9
+    %27 = mul i64 %26, 6364136223846793005
+    %28 = add i64 %27, 1442695040888963407
+    store i64 %28, ptr %9
+    %29 = load i64, ptr %10
+    %30 = add nsw i64 %29, 1
+    store i64 %30, ptr %10
+    br label %L4
+L6:
+    %31 = load i64, ptr %7
+    %32 = load i64, ptr %9
+    %33 = add i64 %31, %32
+    store i64 %33, ptr %7
+    %34 = load i64, ptr %8
+    %35 = add nsw i64 %34, 1
+    store i64 %35, ptr %8
+    br label %L1
+L3:
+    %36 = load i64, ptr %7
+    %37 = inttoptr i64 %36 to ptr
+    ret ptr %37
+}
+define i64 @collect(ptr %0) nounwind norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = load ptr, ptr %1
+    store ptr %5, ptr %2
+    store i64 0, ptr %3
+    store i64 0, ptr %4
+    br label %L1
+L1:
+    %6 = load i64, ptr %4
+    %7 = load ptr, ptr %2
+    %8 = getelementptr inbounds i64, ptr %7, i64 -1
+    %9 = load i64, ptr %8
+    %10 = icmp slt i64 %6, %9
+    br i1 %10, label %L2, label %L3
+L2:
+    %11 = load i64, ptr %3
+    %12 = load ptr, ptr %2
+    %13 = load i64, ptr %4
+    %14 = getelementptr inbounds i64, ptr %12, i64 %13
+    %15 = load i64, ptr %14
+    %16 = add i64 %11, %15
+    store i64 %16, ptr %3
+    %17 = load i64, ptr %4
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %4
+    br label %L1
+L3:
+    %19 = load ptr, ptr %1
+    %20 = sub i64 0, 1
+    %21 = getelementptr inbounds ptr, ptr %19, i64 %20
+    call void @dealloc(ptr %21)
+    %22 = load i64, ptr %3
+    ret i64 %22
+}
+define double @tail(i64 %0, i64 %1, i64 %2) nounwind {
+L0:
+    %3 = alloca i64
+    store i64 %0, ptr %3
+    %4 = alloca i64
+    store i64 %1, ptr %4
+    %5 = alloca i64
+    store i64 %2, ptr %5
+    %6 = alloca ptr
+    %7 = alloca double
+    %8 = alloca i64
+    %9 = alloca double
+    %10 = call ptr @alloc(i64 8)
+    store ptr %10, ptr %6
+    %11 = load i64, ptr %3
+    %12 = load ptr, ptr %6
+    %13 = getelementptr inbounds i64, ptr %12, i64 0
+    store i64 %11, ptr %13
+    store double 0.000000, ptr %7
+    store i64 0, ptr %8
+    br label %L1
+L1:
+    %14 = load i64, ptr %8
+    %15 = load i64, ptr %5
+    %16 = icmp slt i64 %14, %15
+    br i1 %16, label %L2, label %L3
+L2:
+    %17 = call double @pc_time()
+    %18 = fneg double %17
+    store double %18, ptr %9
+    %19 = load ptr, ptr %6
+    %20 = load i64, ptr %3
+    %21 = load i64, ptr %4
+    %22 = call ptr @parallel_for_grain(ptr %19, i64 %20, i64 %21, ptr @skewed)
+    %23 = call i64 @collect(ptr %22)
+    %24 = load double, ptr %9
+    %25 = call double @pc_time()
+    %26 = fadd double %24, %25
+    store double %26, ptr %9
+    %27 = load double, ptr %9
+    %28 = load double, ptr %7
+    %29 = fcmp ogt double %27, %28
+    br i1 %29, label %L4, label %L5
+L4:
+    %30 = load double, ptr %9
+    store double %30, ptr %7
+    br label %L6
+L5:
+    br label %L6
+L6:
+    %31 = load i64, ptr %8
+    %32 = add nsw i64 %31, 1
+    store i64 %32, ptr %8
+    br label %L1
+L3:
+    %33 = load ptr, ptr %6
+    call void @dealloc(ptr %33)
+    %34 = load double, ptr %7
+    %35 = fmul double %34, 1000.000000
+    ret double %35
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca i64
+    %2 = alloca ptr
+    %3 = alloca i64
+    store i64 16384, ptr %0
+    %4 = call i64 @thread_count()
+    store i64 %4, ptr %1
+    %5 = call ptr @alloc(i64 8)
+    store ptr %5, ptr %2
+    %6 = load i64, ptr %0
+    %7 = load ptr, ptr %2
+    %8 = getelementptr inbounds i64, ptr %7, i64 0
+    store i64 %6, ptr %8
+    %9 = load ptr, ptr %2
+    %10 = load i64, ptr %0
+    %11 = load i64, ptr %0
+    %12 = load i64, ptr %1
+    %13 = add nsw i64 %11, %12
+    %14 = sub nsw i64 %13, 1
+    %15 = load i64, ptr %1
+    %16 = sdiv i64 %14, %15
+    %17 = call ptr @parallel_for_grain(ptr %9, i64 %10, i64 %16, ptr @skewed)
+    %18 = call i64 @collect(ptr %17)
+    call void @printint(i64 %18)
+    %19 = load ptr, ptr %2
+    %20 = load i64, ptr %0
+    %21 = call ptr @parallel_for(ptr %19, i64 %20, ptr @skewed)
+    %22 = call i64 @collect(ptr %21)
+    call void @printint(i64 %22)
+    %23 = load ptr, ptr %2
+    call void @dealloc(ptr %23)
+    store i64 20, ptr %3
+    %24 = load i64, ptr %0
+    %25 = load i64, ptr %0
+    %26 = load i64, ptr %1
+    %27 = add nsw i64 %25, %26
+    %28 = sub nsw i64 %27, 1
+    %29 = load i64, ptr %1
+    %30 = sdiv i64 %28, %29
+    %31 = load i64, ptr %3
+    %32 = call double @tail(i64 %24, i64 %30, i64 %31)
+    call void @printfloat(double %32)
+    %33 = load i64, ptr %0
+    %34 = load i64, ptr %3
+    %35 = call double @tail(i64 %33, i64 0, i64 %34)
+    call void @printfloat(double %35)
+    ret i64 0
+}
@@ -0,0 +1,332 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @sum({ ptr, i64 } %0) readonly nounwind norecurse {
+L0:
+    %1 = alloca { ptr, i64 }
+    store { ptr, i64 } %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = extractvalue { ptr, i64 } %0, 1
+    %5 = icmp sge i64 %4, 0
+    call void @llvm.assume(i1 %5)
+    store i64 0, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %6 = load i64, ptr %3
+    %7 = load { ptr, i64 }, ptr %1
+    %8 = extractvalue { ptr, i64 } %7, 1
+    %9 = icmp slt i64 %6, %8
+    br i1 %9, label %L2, label %L3
+L2:
+    %10 = load i64, ptr %2
+    %11 = load { ptr, i64 }, ptr %1
+    %12 = load i64, ptr %3
+    %13 = extractvalue { ptr, i64 } %11, 0
+    %14 = getelementptr inbounds i64, ptr %13, i64 %12
+    %15 = load i64, ptr %14
+    %16 = add nsw i64 %10, %15
+    store i64 %16, ptr %2
+    %17 = load i64, ptr %3
+    %18 = add nsw i64 %17, 1
+    store i64 %18, ptr %3
+    br label %L1
+L3:
+    %19 = load i64, ptr %2
+    ret i64 %19
+}
+define void @reverse({ ptr, i64 } %0) nounwind norecurse {
+L0:
+    %1 = alloca { ptr, i64 }
+    store { ptr, i64 } %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = extractvalue { ptr, i64 } %0, 1
+    %6 = icmp sge i64 %5, 0
+    call void @llvm.assume(i1 %6)
+    store i64 0, ptr %2
+    %7 = load { ptr, i64 }, ptr %1
+    %8 = extractvalue { ptr, i64 } %7, 1
+    %9 = sub nsw i64 %8, 1
+    store i64 %9, ptr %3
+    br label %L1
+L1:
+    %10 = load i64, ptr %2
+    %11 = load i64, ptr %3
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load { ptr, i64 }, ptr %1
+    %14 = load i64, ptr %2
+    %15 = extractvalue { ptr, i64 } %13, 0
+    %16 = getelementptr inbounds i64, ptr %15, i64 %14
+    %17 = load i64, ptr %16
+    store i64 %17, ptr %4
+    %18 = load { ptr, i64 }, ptr %1
+    %19 = load i64, ptr %3
+    %20 = extractvalue { ptr, i64 } %18, 0
+    %21 = getelementptr inbounds i64, ptr %20, i64 %19
+    %22 = load i64, ptr %21
+    %23 = load { ptr, i64 }, ptr %1
+    %24 = load i64, ptr %2
+    %25 = extractvalue { ptr, i64 } %23, 0
+    %26 = getelementptr inbounds i64, ptr %25, i64 %24
+    store i64 %22, ptr %26
+    %27 = load i64, ptr %4
+    %28 = load { ptr, i64 }, ptr %1
+    %29 = load i64, ptr %3
+    %30 = extractvalue { ptr, i64 } %28, 0
+    %31 = getelementptr inbounds i64, ptr %30, i64 %29
+    store i64 %27, ptr %31
+    %32 = load i64, ptr %2
+    %33 = add nsw i64 %32, 1
+    store i64 %33, ptr %2
+    %34 = load i64, ptr %3
+    %35 = add nsw i64 %34, -1
+    store i64 %35, ptr %3
+    br label %L1
+L3:
+    ret void
+}
+define i64 @count({ ptr, i64 } %0, double %1) readonly nounwind norecurse {
+L0:
+    %2 = alloca { ptr, i64 }
+    store { ptr, i64 } %0, ptr %2
+    %3 = alloca double
+    store double %1, ptr %3
+    %4 = alloca i64
+    %5 = alloca i64
+    %6 = extractvalue { ptr, i64 } %0, 1
+    %7 = icmp sge i64 %6, 0
+    call void @llvm.assume(i1 %7)
+    store i64 0, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %8 = load i64, ptr %5
+    %9 = load { ptr, i64 }, ptr %2
+    %10 = extractvalue { ptr, i64 } %9, 1
+    %11 = icmp slt i64 %8, %10
+    br i1 %11, label %L2, label %L3
+L2:
+    %12 = load { ptr, i64 }, ptr %2
+    %13 = load i64, ptr %5
+    %14 = extractvalue { ptr, i64 } %12, 0
+    %15 = getelementptr inbounds double, ptr %14, i64 %13
+    %16 = load double, ptr %15
+    %17 = load double, ptr %3
+    %18 = fcmp olt double %16, %17
+    br i1 %18, label %L4, label %L5
+L4:
+    %19 = load i64, ptr %4
+    %20 = add nsw i64 %19, 1
+    store i64 %20, ptr %4
+    br label %L6
+L5:
+    br label %L6
+L6:
+    %21 = load i64, ptr %5
+    %22 = add nsw i64 %21, 1
+    store i64 %22, ptr %5
+    br label %L1
+L3:
+    %23 = load i64, ptr %4
+    ret i64 %23
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca { ptr, i64 }
+    %4 = alloca { ptr, i64 }
+    %5 = alloca ptr
+    %6 = alloca { ptr, i64 }
+    store i64 10, ptr %0
+    %7 = load i64, ptr %0
+    %8 = mul nsw i64 8, %7
+    %9 = call ptr @alloc(i64 %8)
+    store ptr %9, ptr %1
+    store i64 0, ptr %2
+    br label %L1
+L1:
+    %10 = load i64, ptr %2
+    %11 = load i64, ptr %0
+    %12 = icmp slt i64 %10, %11
+    br i1 %12, label %L2, label %L3
+L2:
+    %13 = load i64, ptr %2
+    %14 = load i64, ptr %2
+    %15 = mul nsw i64 %13, %14
+    %16 = load ptr, ptr %1
+    %17 = load i64, ptr %2
+    %18 = getelementptr inbounds i64, ptr %16, i64 %17
+    store i64 %15, ptr %18
+    %19 = load i64, ptr %2
+    %20 = add nsw i64 %19, 1
+    store i64 %20, ptr %2
+    br label %L1
+L3:
+    %21 = load ptr, ptr %1
+    %22 = load i64, ptr %0
+    %23 = getelementptr inbounds i64, ptr %21, i64 0
+    %24 = sub i64 %22, 0
+    %25 = insertvalue { ptr, i64 } undef, ptr %23, 0
+    %26 = insertvalue { ptr, i64 } %25, i64 %24, 1
+    store { ptr, i64 } %26, ptr %3
+    %27 = load { ptr, i64 }, ptr %3
+    %28 = extractvalue { ptr, i64 } %27, 1
+    call void @printint(i64 %28)
+    %29 = load { ptr, i64 }, ptr %3
+    %30 = call i64 @sum({ ptr, i64 } %29)
+    call void @printint(i64 %30)
+    %31 = load { ptr, i64 }, ptr %3
+    %32 = extractvalue { ptr, i64 } %31, 0
+    %33 = extractvalue { ptr, i64 } %31, 1
+    %34 = getelementptr inbounds i64, ptr %32, i64 2
+    %35 = sub i64 7, 2
+    %36 = insertvalue { ptr, i64 } undef, ptr %34, 0
+    %37 = insertvalue { ptr, i64 } %36, i64 %35, 1
+    store { ptr, i64 } %37, ptr %4
+    %38 = load { ptr, i64 }, ptr %4
+    %39 = extractvalue { ptr, i64 } %38, 1
+    call void @printint(i64 %39)
+    %40 = load { ptr, i64 }, ptr %4
+    %41 = call i64 @sum({ ptr, i64 } %40)
+    call void @printint(i64 %41)
+    %42 = load { ptr, i64 }, ptr %4
+    %43 = extractvalue { ptr, i64 } %42, 0
+    %44 = extractvalue { ptr, i64 } %42, 1
+    %45 = getelementptr inbounds i64, ptr %43, i64 3
+    %46 = sub i64 %44, 3
+    %47 = insertvalue { ptr, i64 } undef, ptr %45, 0
+    %48 = insertvalue { ptr, i64 } %47, i64 %46, 1
+    %49 = call i64 @sum({ ptr, i64 } %48)
+    %50 = load { ptr, i64 }, ptr %3
+    %51 = extractvalue { ptr, i64 } %50, 0
+    %52 = extractvalue { ptr, i64 } %50, 1
+    %53 = insertvalue { ptr, i64 } undef, ptr %51, 0
+    %54 = insertvalue { ptr, i64 } %53, i64 3, 1
+    %55 = call i64 @sum({ ptr, i64 } %54)
+    %56 = add nsw i64 %49, %55
+    call void @printint(i64 %56)
+    %57 = load { ptr, i64 }, ptr %4
+    call void @reverse({ ptr, i64 } %57)
+    %58 = load { ptr, i64 }, ptr %3
+    %59 = extractvalue { ptr, i64 } %58, 0
+    %60 = load { ptr, i64 }, ptr %3
+    %61 = extractvalue { ptr, i64 } %60, 1
+    call void @print_int_array(ptr %59, i64 %61)
+    %62 = load { ptr, i64 }, ptr %4
+    %63 = extractvalue { ptr, i64 } %62, 0
+    %64 = getelementptr inbounds i64, ptr %63, i64 0
+    %65 = load i64, ptr %64
+    call void @printint(i64 %65)
+    %66 = load i64, ptr %0
+    %67 = mul nsw i64 8, %66
+    %68 = call ptr @alloc(i64 %67)
+    store ptr %68, ptr %5
+    store i64 0, ptr %2
+    br label %L4
+L4:
+    %69 = load i64, ptr %2
+    %70 = load i64, ptr %0
+    %71 = icmp slt i64 %69, %70
+    br i1 %71, label %L5, label %L6
+L5:
+    %72 = load i64, ptr %2
+    %73 = sitofp i64 %72 to double
+    %74 = fdiv double %73, 2.000000
+    %75 = load ptr, ptr %5
+    %76 = load i64, ptr %2
+    %77 = getelementptr inbounds double, ptr %75, i64 %76
+    store double %74, ptr %77
+    %78 = load i64, ptr %2
+    %79 = add nsw i64 %78, 1
+    store i64 %79, ptr %2
+    br label %L4
+L6:
+    %80 = load ptr, ptr %5
+    %81 = load i64, ptr %0
+    %82 = getelementptr inbounds double, ptr %80, i64 0
+    %83 = sub i64 %81, 0
+    %84 = insertvalue { ptr, i64 } undef, ptr %82, 0
+    %85 = insertvalue { ptr, i64 } %84, i64 %83, 1
+    store { ptr, i64 } %85, ptr %6
+    %86 = load { ptr, i64 }, ptr %6
+    %87 = call i64 @count({ ptr, i64 } %86, double 2.000000)
+    call void @printint(i64 %87)
+    %88 = load { ptr, i64 }, ptr %6
+    %89 = extractvalue { ptr, i64 } %88, 0
+    %90 = extractvalue { ptr, i64 } %88, 1
+    %91 = getelementptr inbounds double, ptr %89, i64 5
+    %92 = sub i64 %90, 5
+    %93 = insertvalue { ptr, i64 } undef, ptr %91, 0
+    %94 = insertvalue { ptr, i64 } %93, i64 %92, 1
+    %95 = call i64 @count({ ptr, i64 } %94, double 4.000000)
+    call void @printint(i64 %95)
+    %96 = load ptr, ptr %5
+    call void @dealloc(ptr %96)
+    %97 = load ptr, ptr %1
+    call void @dealloc(ptr %97)
+    ret i64 0
+}
+declare void @llvm.assume(i1 noundef)
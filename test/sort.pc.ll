@@ -1,16 +1,63 @@
-declare void @printint(i64 %0)
-declare void @printfloat(double %0)
-declare void @print_int_array(ptr %0, i64 %1)
-declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4)
-declare ptr @alloc(i64 %0)
-declare void @dealloc(ptr %0)
-declare ptr @parallel_for(ptr %0, i64 %1, ptr %2)
-declare i64 @thread_create(ptr %0, ptr %1)
-declare ptr @thread_join(i64 %0)
-declare i64 @thread_self()
-declare double @pc_time()
-declare void @exit(i64 %0)
-define void @swap(ptr %0, ptr %1) {
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define void @swap(ptr %0, ptr %1) nounwind willreturn norecurse {
 L0:
     %2 = alloca ptr
     store ptr %0, ptr %2
@@ -62,7 +109,7 @@ L5:
     br label %L6
 L6:
     %18 = load ptr, ptr %3
-    %19 = getelementptr inbounds ptr, ptr %18, i64 1
+    %19 = getelementptr inbounds i64, ptr %18, i64 1
     store ptr %19, ptr %3
     br label %L1
 L3:
@@ -91,13 +138,13 @@ L2:
     %13 = call ptr @min_element(ptr %10, ptr %11, ptr %12)
     call void @swap(ptr %9, ptr %13)
     %14 = load ptr, ptr %3
-    %15 = getelementptr inbounds ptr, ptr %14, i64 1
+    %15 = getelementptr inbounds i64, ptr %14, i64 1
     store ptr %15, ptr %3
     br label %L1
 L3:
     ret void
 }
-define i1 @less(i64 %0, i64 %1) {
+define i1 @less(i64 %0, i64 %1) readnone nounwind willreturn norecurse {
 L0:
     %2 = alloca i64
     store i64 %0, ptr %2
@@ -108,7 +155,7 @@ L0:
     %6 = icmp slt i64 %4, %5
     ret i1 %6
 }
-define i1 @greater(i64 %0, i64 %1) {
+define i1 @greater(i64 %0, i64 %1) readnone nounwind willreturn norecurse {
 L0:
     %2 = alloca i64
     store i64 %0, ptr %2
@@ -123,7 +170,7 @@ define void @main() {
 L0:
     %0 = alloca ptr
     %1 = alloca i64
-    %2 = mul i64 10, 8
+    %2 = mul nsw i64 10, 8
     %3 = call ptr @alloc(i64 %2)
     store ptr %3, ptr %0
     %4 = load ptr, ptr %0
@@ -141,21 +188,21 @@ L1:
 L2:
     %10 = load ptr, ptr %0
     %11 = load i64, ptr %1
-    %12 = sub i64 %11, 1
+    %12 = sub nsw i64 %11, 1
     %13 = getelementptr inbounds i64, ptr %10, i64 %12
     %14 = load i64, ptr %13
     %15 = load ptr, ptr %0
     %16 = load i64, ptr %1
-    %17 = sub i64 %16, 2
+    %17 = sub nsw i64 %16, 2
     %18 = getelementptr inbounds i64, ptr %15, i64 %17
     %19 = load i64, ptr %18
-    %20 = add i64 %14, %19
+    %20 = add nsw i64 %14, %19
     %21 = load ptr, ptr %0
     %22 = load i64, ptr %1
     %23 = getelementptr inbounds i64, ptr %21, i64 %22
     store i64 %20, ptr %23
     %24 = load i64, ptr %1
-    %25 = add i64 %24, 1
+    %25 = add nsw i64 %24, 1
     store i64 %25, ptr %1
     br label %L1
 L3:
@@ -163,13 +210,13 @@ L3:
     call void @print_int_array(ptr %26, i64 10)
     %27 = load ptr, ptr %0
     %28 = load ptr, ptr %0
-    %29 = getelementptr inbounds ptr, ptr %28, i64 10
+    %29 = getelementptr inbounds i64, ptr %28, i64 10
     call void @sort(ptr %27, ptr %29, ptr @greater)
     %30 = load ptr, ptr %0
     call void @print_int_array(ptr %30, i64 10)
     %31 = load ptr, ptr %0
     %32 = load ptr, ptr %0
-    %33 = getelementptr inbounds ptr, ptr %32, i64 10
+    %33 = getelementptr inbounds i64, ptr %32, i64 10
     call void @sort(ptr %31, ptr %33, ptr @less)
     %34 = load ptr, ptr %0
     call void @print_int_array(ptr %34, i64 10)
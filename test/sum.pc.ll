@@ -1,16 +1,63 @@
-declare void @printint(i64 %0)
-declare void @printfloat(double %0)
-declare void @print_int_array(ptr %0, i64 %1)
-declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4)
-declare ptr @alloc(i64 %0)
-declare void @dealloc(ptr %0)
-declare ptr @parallel_for(ptr %0, i64 %1, ptr %2)
-declare i64 @thread_create(ptr %0, ptr %1)
-declare ptr @thread_join(i64 %0)
-declare i64 @thread_self()
-declare double @pc_time()
-declare void @exit(i64 %0)
-define ptr @plus(ptr %0, ptr %1) {
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define ptr @plus(ptr %0, ptr %1) readnone nounwind willreturn norecurse {
 L0:
     %2 = alloca ptr
     store ptr %0, ptr %2
@@ -20,11 +67,11 @@ L0:
     %5 = ptrtoint ptr %4 to i64
     %6 = load ptr, ptr %3
     %7 = ptrtoint ptr %6 to i64
-    %8 = add i64 %5, %7
+    %8 = add nsw i64 %5, %7
     %9 = inttoptr i64 %8 to ptr
     ret ptr %9
 }
-define ptr @deref(ptr %0) {
+define ptr @deref(ptr %0) readonly nounwind willreturn norecurse {
 L0:
     %1 = alloca ptr
     store ptr %0, ptr %1
@@ -33,7 +80,7 @@ L0:
     %4 = inttoptr i64 %3 to ptr
     ret ptr %4
 }
-define ptr @range_sum(ptr %0, i64 %1, i64 %2) {
+define ptr @range_sum(ptr %0, i64 %1, i64 %2) readonly nounwind norecurse {
 L0:
     %3 = alloca ptr
     store ptr %0, ptr %3
@@ -59,13 +106,13 @@ L2:
     %14 = load ptr, ptr %7
     %15 = load i64, ptr %4
     %16 = load i64, ptr %8
-    %17 = add i64 %15, %16
+    %17 = add nsw i64 %15, %16
     %18 = getelementptr inbounds i64, ptr %14, i64 %17
     %19 = load i64, ptr %18
-    %20 = add i64 %13, %19
+    %20 = add nsw i64 %13, %19
     store i64 %20, ptr %6
     %21 = load i64, ptr %8
-    %22 = add i64 %21, 1
+    %22 = add nsw i64 %21, 1
     store i64 %22, ptr %8
     br label %L1
 L3:
@@ -73,7 +120,7 @@ L3:
     %24 = inttoptr i64 %23 to ptr
     ret ptr %24
 }
-define void @main() {
+define void @main() nounwind {
 L0:
     %0 = alloca i64
     %1 = alloca ptr
@@ -85,124 +132,189 @@ L0:
     %7 = alloca double
     %8 = alloca ptr
     %9 = alloca i64
+    %10 = alloca double
+    %11 = alloca i64
+    %12 = alloca ptr
     store i64 100000000, ptr %0
-    %10 = load i64, ptr %0
-    %11 = mul i64 8, %10
-    %12 = call ptr @alloc(i64 %11)
-    store ptr %12, ptr %1
+    %13 = load i64, ptr %0
+    %14 = mul nsw i64 8, %13
+    %15 = call ptr @alloc(i64 %14)
+    store ptr %15, ptr %1
     store i64 0, ptr %2
     br label %L1
 L1:
-    %13 = load i64, ptr %2
-    %14 = load i64, ptr %0
-    %15 = icmp slt i64 %13, %14
-    br i1 %15, label %L2, label %L3
-L2:
     %16 = load i64, ptr %2
-    %17 = add i64 %16, 1
-    %18 = load ptr, ptr %1
+    %17 = load i64, ptr %0
+    %18 = icmp slt i64 %16, %17
+    br i1 %18, label %L2, label %L3
+L2:
     %19 = load i64, ptr %2
-    %20 = getelementptr inbounds i64, ptr %18, i64 %19
-    store i64 %17, ptr %20
-    %21 = load i64, ptr %2
-    %22 = add i64 %21, 1
-    store i64 %22, ptr %2
+    %20 = add nsw i64 %19, 1
+    %21 = load ptr, ptr %1
+    %22 = load i64, ptr %2
+    %23 = getelementptr inbounds i64, ptr %21, i64 %22
+    store i64 %20, ptr %23
+    %24 = load i64, ptr %2
+    %25 = add nsw i64 %24, 1
+    store i64 %25, ptr %2
     br label %L1
 L3:
     store i64 0, ptr %2
-    %23 = call double @pc_time()
-    %24 = fneg double %23
-    store double %24, ptr %3
+    %26 = call double @pc_time()
+    %27 = fneg double %26
+    store double %27, ptr %3
     store i64 0, ptr %4
     br label %L4
 L4:
-    %25 = load i64, ptr %2
-    %26 = load i64, ptr %0
-    %27 = icmp slt i64 %25, %26
-    br i1 %27, label %L5, label %L6
+    %28 = load i64, ptr %2
+    %29 = load i64, ptr %0
+    %30 = icmp slt i64 %28, %29
+    br i1 %30, label %L5, label %L6
 L5:
-    %28 = load i64, ptr %4
-    %29 = load ptr, ptr %1
-    %30 = load i64, ptr %2
-    %31 = getelementptr inbounds i64, ptr %29, i64 %30
-    %32 = load i64, ptr %31
-    %33 = add i64 %28, %32
-    store i64 %33, ptr %4
-    %34 = load i64, ptr %2
-    %35 = add i64 %34, 1
-    store i64 %35, ptr %2
+    %31 = load i64, ptr %4
+    %32 = load ptr, ptr %1
+    %33 = load i64, ptr %2
+    %34 = getelementptr inbounds i64, ptr %32, i64 %33
+    %35 = load i64, ptr %34
+    %36 = add nsw i64 %31, %35
+    store i64 %36, ptr %4
+    %37 = load i64, ptr %2
+    %38 = add nsw i64 %37, 1
+    store i64 %38, ptr %2
     br label %L4
 L6:
-    %36 = load double, ptr %3
-    %37 = call double @pc_time()
-    %38 = fadd double %36, %37
-    store double %38, ptr %3
-    %39 = load i64, ptr %4
-    call void @printint(i64 %39)
-    %40 = load double, ptr %3
-    %41 = fmul double %40, 1000.000000
-    call void @printfloat(double %41)
-    %42 = call double @pc_time()
-    %43 = fneg double %42
-    store double %43, ptr %5
-    %44 = load ptr, ptr %1
-    %45 = load i64, ptr %0
-    %46 = call ptr @parallel_reduce(ptr %44, i64 8, i64 %45, ptr @deref, ptr @plus)
-    %47 = ptrtoint ptr %46 to i64
-    store i64 %47, ptr %6
-    %48 = load double, ptr %5
-    %49 = call double @pc_time()
-    %50 = fadd double %48, %49
-    store double %50, ptr %5
-    %51 = load i64, ptr %6
-    call void @printint(i64 %51)
-    %52 = load double, ptr %5
-    %53 = fmul double %52, 1000.000000
-    call void @printfloat(double %53)
-    %54 = call double @pc_time()
-    %55 = fneg double %54
-    store double %55, ptr %7
-    %56 = load ptr, ptr %1
-    %57 = load i64, ptr %0
-    %58 = call ptr @parallel_for(ptr %56, i64 %57, ptr @range_sum)
-    store ptr %58, ptr %8
+    %39 = load double, ptr %3
+    %40 = call double @pc_time()
+    %41 = fadd double %39, %40
+    store double %41, ptr %3
+    %42 = load i64, ptr %4
+    call void @printint(i64 %42)
+    %43 = load double, ptr %3
+    %44 = fmul double %43, 1000.000000
+    call void @printfloat(double %44)
+    %45 = call double @pc_time()
+    %46 = fneg double %45
+    store double %46, ptr %5
+    %47 = load ptr, ptr %1
+    %48 = load i64, ptr %0
+    %49 = call ptr @parallel_reduce(ptr %47, i64 8, i64 %48, ptr @deref, ptr @plus)
+    %50 = ptrtoint ptr %49 to i64
+    store i64 %50, ptr %6
+    %51 = load double, ptr %5
+    %52 = call double @pc_time()
+    %53 = fadd double %51, %52
+    store double %53, ptr %5
+    %54 = load i64, ptr %6
+    call void @printint(i64 %54)
+    %55 = load double, ptr %5
+    %56 = fmul double %55, 1000.000000
+    call void @printfloat(double %56)
+    %57 = call double @pc_time()
+    %58 = fneg double %57
+    store double %58, ptr %7
+    %59 = load ptr, ptr %1
+    %60 = load i64, ptr %0
+    %61 = call ptr @parallel_for(ptr %59, i64 %60, ptr @range_sum)
+    store ptr %61, ptr %8
     store i64 0, ptr %9
     store i64 0, ptr %2
     br label %L7
 L7:
-    %59 = load i64, ptr %2
-    %60 = load ptr, ptr %8
-    %61 = getelementptr inbounds i64, ptr %60, i64 -1
-    %62 = load i64, ptr %61
-    %63 = icmp slt i64 %59, %62
-    br i1 %63, label %L8, label %L9
+    %62 = load i64, ptr %2
+    %63 = load ptr, ptr %8
+    %64 = getelementptr inbounds i64, ptr %63, i64 -1
+    %65 = load i64, ptr %64
+    %66 = icmp slt i64 %62, %65
+    br i1 %66, label %L8, label %L9
 L8:
-    %64 = load i64, ptr %9
-    %65 = load ptr, ptr %8
-    %66 = load i64, ptr %2
-    %67 = getelementptr inbounds i64, ptr %65, i64 %66
-    %68 = load i64, ptr %67
-    %69 = add i64 %64, %68
-    store i64 %69, ptr %9
-    %70 = load i64, ptr %2
-    %71 = add i64 %70, 1
-    store i64 %71, ptr %2
+    %67 = load i64, ptr %9
+    %68 = load ptr, ptr %8
+    %69 = load i64, ptr %2
+    %70 = getelementptr inbounds i64, ptr %68, i64 %69
+    %71 = load i64, ptr %70
+    %72 = add nsw i64 %67, %71
+    store i64 %72, ptr %9
+    %73 = load i64, ptr %2
+    %74 = add nsw i64 %73, 1
+    store i64 %74, ptr %2
     br label %L7
 L9:
-    %72 = load double, ptr %7
-    %73 = call double @pc_time()
-    %74 = fadd double %72, %73
-    store double %74, ptr %7
-    %75 = load i64, ptr %9
-    call void @printint(i64 %75)
-    %76 = load double, ptr %7
-    %77 = fmul double %76, 1000.000000
-    call void @printfloat(double %77)
-    %78 = load ptr, ptr %8
-    %79 = sub i64 0, 1
-    %80 = getelementptr inbounds ptr, ptr %78, i64 %79
-    call void @dealloc(ptr %80)
-    %81 = load ptr, ptr %1
-    call void @dealloc(ptr %81)
+    %75 = load double, ptr %7
+    %76 = call double @pc_time()
+    %77 = fadd double %75, %76
+    store double %77, ptr %7
+    %78 = load i64, ptr %9
+    call void @printint(i64 %78)
+    %79 = load double, ptr %7
+    %80 = fmul double %79, 1000.000000
+    call void @printfloat(double %80)
+    %81 = call double @pc_time()
+    %82 = fneg double %81
+    store double %82, ptr %10
+    %83 = load ptr, ptr %1
+    %84 = load i64, ptr %0
+    %85 = call i64 @reduce_sum_int(ptr %83, i64 %84)
+    store i64 %85, ptr %11
+    %86 = load double, ptr %10
+    %87 = call double @pc_time()
+    %88 = fadd double %86, %87
+    store double %88, ptr %10
+    %89 = load i64, ptr %11
+    call void @printint(i64 %89)
+    %90 = load double, ptr %10
+    %91 = fmul double %90, 1000.000000
+    call void @printfloat(double %91)
+    %92 = load ptr, ptr %1
+    %93 = load i64, ptr %0
+    %94 = call i64 @reduce_min_int(ptr %92, i64 %93)
+    call void @printint(i64 %94)
+    %95 = load ptr, ptr %1
+    %96 = load i64, ptr %0
+    %97 = call i64 @reduce_max_int(ptr %95, i64 %96)
+    call void @printint(i64 %97)
+    %98 = load ptr, ptr %1
+    %99 = load i64, ptr %0
+    %100 = call i64 @reduce_with(ptr %98, i64 %99, i64 5)
+    call void @printint(i64 %100)
+    %101 = mul nsw i64 8, 1000
+    %102 = call ptr @alloc(i64 %101)
+    store ptr %102, ptr %12
+    store i64 0, ptr %2
+    br label %L10
+L10:
+    %103 = load i64, ptr %2
+    %104 = icmp slt i64 %103, 1000
+    br i1 %104, label %L11, label %L12
+L11:
+    %105 = load i64, ptr %2
+    %106 = sub nsw i64 %105, 500
+    %107 = sitofp i64 %106 to double
+    %108 = fmul double %107, 0.500000
+    %109 = load ptr, ptr %12
+    %110 = load i64, ptr %2
+    %111 = getelementptr inbounds double, ptr %109, i64 %110
+    store double %108, ptr %111
+    %112 = load i64, ptr %2
+    %113 = add nsw i64 %112, 1
+    store i64 %113, ptr %2
+    br label %L10
+L12:
+    %114 = load ptr, ptr %12
+    %115 = call double @reduce_sum_float(ptr %114, i64 1000)
+    call void @printfloat(double %115)
+    %116 = load ptr, ptr %12
+    %117 = call double @reduce_min_float(ptr %116, i64 1000)
+    call void @printfloat(double %117)
+    %118 = load ptr, ptr %12
+    %119 = call double @reduce_max_float(ptr %118, i64 1000)
+    call void @printfloat(double %119)
+    %120 = load ptr, ptr %12
+    call void @dealloc(ptr %120)
+    %121 = load ptr, ptr %8
+    %122 = sub i64 0, 1
+    %123 = getelementptr inbounds i64, ptr %121, i64 %122
+    call void @dealloc(ptr %123)
+    %124 = load ptr, ptr %1
+    call void @dealloc(ptr %124)
     ret void
 }
@@ -0,0 +1,221 @@
+@crc8_table = unnamed_addr constant [256 x i8] [i8 0, i8 7, i8 14, i8 9, i8 28, i8 27, i8 18, i8 21, i8 56, i8 63, i8 54, i8 49, i8 36, i8 35, i8 42, i8 45, i8 112, i8 119, i8 126, i8 121, i8 108, i8 107, i8 98, i8 101, i8 72, i8 79, i8 70, i8 65, i8 84, i8 83, i8 90, i8 93, i8 224, i8 231, i8 238, i8 233, i8 252, i8 251, i8 242, i8 245, i8 216, i8 223, i8 214, i8 209, i8 196, i8 195, i8 202, i8 205, i8 144, i8 151, i8 158, i8 153, i8 140, i8 139, i8 130, i8 133, i8 168, i8 175, i8 166, i8 161, i8 180, i8 179, i8 186, i8 189, i8 199, i8 192, i8 201, i8 206, i8 219, i8 220, i8 213, i8 210, i8 255, i8 248, i8 241, i8 246, i8 227, i8 228, i8 237, i8 234, i8 183, i8 176, i8 185, i8 190, i8 171, i8 172, i8 165, i8 162, i8 143, i8 136, i8 129, i8 134, i8 147, i8 148, i8 157, i8 154, i8 39, i8 32, i8 41, i8 46, i8 59, i8 60, i8 53, i8 50, i8 31, i8 24, i8 17, i8 22, i8 3, i8 4, i8 13, i8 10, i8 87, i8 80, i8 89, i8 94, i8 75, i8 76, i8 69, i8 66, i8 111, i8 104, i8 97, i8 102, i8 115, i8 116, i8 125, i8 122, i8 137, i8 142, i8 135, i8 128, i8 149, i8 146, i8 155, i8 156, i8 177, i8 182, i8 191, i8 184, i8 173, i8 170, i8 163, i8 164, i8 249, i8 254, i8 247, i8 240, i8 229, i8 226, i8 235, i8 236, i8 193, i8 198, i8 207, i8 200, i8 221, i8 218, i8 211, i8 212, i8 105, i8 110, i8 103, i8 96, i8 117, i8 114, i8 123, i8 124, i8 81, i8 86, i8 95, i8 88, i8 77, i8 74, i8 67, i8 68, i8 25, i8 30, i8 23, i8 16, i8 5, i8 2, i8 11, i8 12, i8 33, i8 38, i8 47, i8 40, i8 61, i8 58, i8 51, i8 52, i8 78, i8 73, i8 64, i8 71, i8 82, i8 85, i8 92, i8 91, i8 118, i8 113, i8 120, i8 127, i8 106, i8 109, i8 100, i8 99, i8 62, i8 57, i8 48, i8 55, i8 34, i8 37, i8 44, i8 43, i8 6, i8 1, i8 8, i8 15, i8 26, i8 29, i8 20, i8 19, i8 174, i8 169, i8 160, i8 167, i8 178, i8 181, i8 188, i8 187, i8 150, i8 145, i8 152, i8 159, i8 138, i8 141, i8 132, i8 131, i8 222, i8 217, i8 208, i8 215, i8 194, i8 197, i8 204, i8 203, i8 230, i8 225, i8 232, i8 239, i8 250, i8 253, i8 244, i8 243], align 16
+@weights = unnamed_addr constant [4 x double] [double 0.500000, double 0.250000, double 0.125000, double 0.125000], align 16
+@crc_sum = global i64 32640
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define zeroext i8 @crc8(ptr %0, i64 %1) readonly nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i8
+    %5 = alloca i64
+    store i8 0, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %6 = load i64, ptr %5
+    %7 = load i64, ptr %3
+    %8 = icmp slt i64 %6, %7
+    br i1 %8, label %L2, label %L3
+L2:
+    %9 = load i8, ptr %4
+    %10 = load ptr, ptr %2
+    %11 = load i64, ptr %5
+    %12 = getelementptr inbounds i8, ptr %10, i64 %11
+    %13 = load i8, ptr %12
+    %14 = xor i8 %9, %13
+    %15 = zext i8 %14 to i64
+    %16 = getelementptr inbounds i8, ptr @crc8_table, i64 %15
+    %17 = load i8, ptr %16
+    store i8 %17, ptr %4
+    %18 = load i64, ptr %5
+    %19 = add nsw i64 %18, 1
+    store i64 %19, ptr %5
+    br label %L1
+L3:
+    %20 = load i8, ptr %4
+    ret i8 %20
+}
+define i64 @popcount(i64 %0) readonly nounwind norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca i64
+    store ptr @.array.0, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %4 = load i64, ptr %1
+    %5 = icmp ne i64 %4, 0
+    br i1 %5, label %L2, label %L3
+L2:
+    %6 = load i64, ptr %3
+    %7 = load ptr, ptr %2
+    %8 = load i64, ptr %1
+    %9 = and i64 %8, 15
+    %10 = getelementptr inbounds i64, ptr %7, i64 %9
+    %11 = load i64, ptr %10
+    %12 = add nsw i64 %6, %11
+    store i64 %12, ptr %3
+    %13 = load i64, ptr %1
+    %14 = lshr i64 %13, 4
+    store i64 %14, ptr %1
+    br label %L1
+L3:
+    %15 = load i64, ptr %3
+    ret i64 %15
+}
+define i64 @table_sum(i64 %0) readonly nounwind norecurse {
+L0:
+    %1 = alloca i64
+    store i64 %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    store i64 0, ptr %2
+    store i64 0, ptr %3
+    br label %L1
+L1:
+    %4 = load i64, ptr %3
+    %5 = load i64, ptr %1
+    %6 = icmp slt i64 %4, %5
+    br i1 %6, label %L2, label %L3
+L2:
+    %7 = load i64, ptr %2
+    %8 = load i64, ptr %3
+    %9 = getelementptr inbounds i8, ptr @crc8_table, i64 %8
+    %10 = load i8, ptr %9
+    %11 = zext i8 %10 to i64
+    %12 = add nsw i64 %7, %11
+    store i64 %12, ptr %2
+    %13 = load i64, ptr %3
+    %14 = add nsw i64 %13, 1
+    store i64 %14, ptr %3
+    br label %L1
+L3:
+    %15 = load i64, ptr %2
+    ret i64 %15
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca ptr
+    %1 = alloca i64
+    %2 = alloca double
+    %3 = call ptr @alloc(i64 9)
+    store ptr %3, ptr %0
+    store i64 0, ptr %1
+    br label %L1
+L1:
+    %4 = load i64, ptr %1
+    %5 = icmp slt i64 %4, 9
+    br i1 %5, label %L2, label %L3
+L2:
+    %6 = load i64, ptr %1
+    %7 = add nsw i64 49, %6
+    %8 = trunc i64 %7 to i8
+    %9 = load ptr, ptr %0
+    %10 = load i64, ptr %1
+    %11 = getelementptr inbounds i8, ptr %9, i64 %10
+    store i8 %8, ptr %11
+    %12 = load i64, ptr %1
+    %13 = add nsw i64 %12, 1
+    store i64 %13, ptr %1
+    br label %L1
+L3:
+    %14 = load ptr, ptr %0
+    %15 = call i8 @crc8(ptr %14, i64 9)
+    %16 = zext i8 %15 to i64
+    call void @printuint(i64 %16)
+    %17 = call i64 @popcount(i64 9223090566172966913)
+    call void @printint(i64 %17)
+    %18 = load i64, ptr @crc_sum
+    call void @printint(i64 %18)
+    store double 0.000000, ptr %2
+    store i64 0, ptr %1
+    br label %L4
+L4:
+    %19 = load i64, ptr %1
+    %20 = icmp slt i64 %19, 4
+    br i1 %20, label %L5, label %L6
+L5:
+    %21 = load double, ptr %2
+    %22 = load i64, ptr %1
+    %23 = getelementptr inbounds double, ptr @weights, i64 %22
+    %24 = load double, ptr %23
+    %25 = load i64, ptr %1
+    %26 = add nsw i64 %25, 1
+    %27 = sitofp i64 %26 to double
+    %28 = fmul double %24, %27
+    %29 = fadd double %21, %28
+    store double %29, ptr %2
+    %30 = load i64, ptr %1
+    %31 = add nsw i64 %30, 1
+    store i64 %31, ptr %1
+    br label %L4
+L6:
+    %32 = load double, ptr %2
+    call void @printfloat(double %32)
+    %33 = load ptr, ptr %0
+    call void @dealloc(ptr %33)
+    ret i64 0
+}
+@.array.0 = private unnamed_addr constant [16 x i64] [i64 0, i64 1, i64 1, i64 2, i64 1, i64 2, i64 2, i64 3, i64 1, i64 2, i64 2, i64 3, i64 2, i64 3, i64 3, i64 4], align 16
@@ -0,0 +1,297 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define ptr @square(ptr %0) readnone nounwind willreturn norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca i64
+    %3 = load ptr, ptr %1
+    %4 = ptrtoint ptr %3 to i64
+    store i64 %4, ptr %2
+    %5 = load i64, ptr %2
+    %6 = load i64, ptr %2
+    %7 = mul nsw i64 %5, %6
+    %8 = inttoptr i64 %7 to ptr
+    ret ptr %8
+}
+define ptr @increment(ptr %0) readnone nounwind willreturn norecurse {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = load ptr, ptr %1
+    %3 = ptrtoint ptr %2 to i64
+    %4 = add nsw i64 %3, 1
+    %5 = inttoptr i64 %4 to ptr
+    ret ptr %5
+}
+define ptr @fib(ptr %0) nounwind {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca i64
+    %5 = load ptr, ptr %1
+    %6 = ptrtoint ptr %5 to i64
+    store i64 %6, ptr %2
+    %7 = load i64, ptr %2
+    %8 = icmp slt i64 %7, 2
+    br i1 %8, label %L1, label %L2
+L1:
+    %9 = load ptr, ptr %1
+    ret ptr %9
+L2:
+    br label %L3
+L3:
+    %10 = load i64, ptr %2
+    %11 = sub nsw i64 %10, 1
+    %12 = inttoptr i64 %11 to ptr
+    %13 = call i64 @task_spawn(ptr @fib, ptr %12)
+    store i64 %13, ptr %3
+    %14 = load i64, ptr %2
+    %15 = sub nsw i64 %14, 2
+    %16 = inttoptr i64 %15 to ptr
+    %17 = call i64 @task_spawn(ptr @fib, ptr %16)
+    store i64 %17, ptr %4
+    %18 = load i64, ptr %3
+    %19 = call ptr @task_wait(i64 %18)
+    %20 = ptrtoint ptr %19 to i64
+    %21 = load i64, ptr %4
+    %22 = call ptr @task_wait(i64 %21)
+    %23 = ptrtoint ptr %22 to i64
+    %24 = add nsw i64 %20, %23
+    %25 = inttoptr i64 %24 to ptr
+    ret ptr %25
+}
+define ptr @block(ptr %0) nounwind {
+L0:
+    %1 = alloca ptr
+    store ptr %0, ptr %1
+    %2 = alloca ptr
+    %3 = alloca ptr
+    %4 = load ptr, ptr %1
+    store ptr %4, ptr %2
+    %5 = call ptr @alloc(i64 8)
+    store ptr %5, ptr %3
+    %6 = load ptr, ptr %2
+    %7 = getelementptr inbounds ptr, ptr %6, i64 0
+    %8 = load ptr, ptr %7
+    %9 = load ptr, ptr %3
+    %10 = call i1 @chan_send(ptr %8, ptr %9)
+    %11 = load ptr, ptr %2
+    %12 = getelementptr inbounds ptr, ptr %11, i64 1
+    %13 = load ptr, ptr %12
+    %14 = load ptr, ptr %3
+    %15 = call i1 @chan_recv(ptr %13, ptr %14)
+    %16 = load ptr, ptr %3
+    ret ptr %16
+}
+define i64 @main() nounwind {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    %3 = alloca i64
+    %4 = alloca double
+    %5 = alloca i64
+    %6 = alloca i64
+    %7 = alloca ptr
+    %8 = alloca ptr
+    %9 = alloca double
+    store i64 100000, ptr %0
+    %10 = load i64, ptr %0
+    %11 = mul nsw i64 8, %10
+    %12 = call ptr @alloc(i64 %11)
+    store ptr %12, ptr %1
+    store i64 0, ptr %2
+    store i64 0, ptr %3
+    store double 0.000000, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %13 = load i64, ptr %2
+    %14 = icmp slt i64 %13, 2
+    br i1 %14, label %L2, label %L3
+L2:
+    %15 = call double @pc_time()
+    %16 = fneg double %15
+    store double %16, ptr %4
+    store i64 0, ptr %5
+    br label %L4
+L4:
+    %17 = load i64, ptr %5
+    %18 = load i64, ptr %0
+    %19 = icmp slt i64 %17, %18
+    br i1 %19, label %L5, label %L6
+L5:
+    %20 = load i64, ptr %5
+    %21 = inttoptr i64 %20 to ptr
+    %22 = call i64 @task_spawn(ptr @square, ptr %21)
+    %23 = load ptr, ptr %1
+    %24 = load i64, ptr %5
+    %25 = getelementptr inbounds i64, ptr %23, i64 %24
+    store i64 %22, ptr %25
+    %26 = load i64, ptr %5
+    %27 = add nsw i64 %26, 1
+    store i64 %27, ptr %5
+    br label %L4
+L6:
+    %28 = load ptr, ptr %1
+    %29 = load ptr, ptr %1
+    %30 = load i64, ptr %0
+    call void @task_wait_all(ptr %28, ptr %29, i64 %30)
+    %31 = load double, ptr %4
+    %32 = call double @pc_time()
+    %33 = fadd double %31, %32
+    store double %33, ptr %4
+    store i64 0, ptr %3
+    store i64 0, ptr %5
+    br label %L7
+L7:
+    %34 = load i64, ptr %5
+    %35 = load i64, ptr %0
+    %36 = icmp slt i64 %34, %35
+    br i1 %36, label %L8, label %L9
+L8:
+    %37 = load i64, ptr %3
+    %38 = load ptr, ptr %1
+    %39 = load i64, ptr %5
+    %40 = getelementptr inbounds i64, ptr %38, i64 %39
+    %41 = load i64, ptr %40
+    %42 = add nsw i64 %37, %41
+    store i64 %42, ptr %3
+    %43 = load i64, ptr %5
+    %44 = add nsw i64 %43, 1
+    store i64 %44, ptr %5
+    br label %L7
+L9:
+    %45 = load i64, ptr %2
+    %46 = add nsw i64 %45, 1
+    store i64 %46, ptr %2
+    br label %L1
+L3:
+    %47 = load i64, ptr %3
+    call void @printint(i64 %47)
+    %48 = load double, ptr %4
+    %49 = fmul double %48, 1000.000000
+    call void @printfloat(double %49)
+    %50 = load ptr, ptr %1
+    call void @dealloc(ptr %50)
+    %51 = inttoptr i64 0 to ptr
+    %52 = call i64 @task_spawn(ptr @increment, ptr %51)
+    store i64 %52, ptr %6
+    store i64 1, ptr %5
+    br label %L10
+L10:
+    %53 = load i64, ptr %5
+    %54 = icmp slt i64 %53, 1000
+    br i1 %54, label %L11, label %L12
+L11:
+    %55 = load i64, ptr %6
+    %56 = call i64 @task_then(i64 %55, ptr @increment)
+    store i64 %56, ptr %6
+    %57 = load i64, ptr %5
+    %58 = add nsw i64 %57, 1
+    store i64 %58, ptr %5
+    br label %L10
+L12:
+    %59 = load i64, ptr %6
+    %60 = call ptr @task_wait(i64 %59)
+    %61 = ptrtoint ptr %60 to i64
+    call void @printint(i64 %61)
+    %62 = inttoptr i64 20 to ptr
+    %63 = call i64 @task_spawn(ptr @fib, ptr %62)
+    %64 = call ptr @task_wait(i64 %63)
+    %65 = ptrtoint ptr %64 to i64
+    call void @printint(i64 %65)
+    %66 = mul nsw i64 8, 2
+    %67 = call ptr @alloc(i64 %66)
+    store ptr %67, ptr %7
+    %68 = call ptr @chan_create(i64 1, i64 8)
+    %69 = load ptr, ptr %7
+    %70 = getelementptr inbounds ptr, ptr %69, i64 0
+    store ptr %68, ptr %70
+    %71 = call ptr @chan_create(i64 1, i64 8)
+    %72 = load ptr, ptr %7
+    %73 = getelementptr inbounds ptr, ptr %72, i64 1
+    store ptr %71, ptr %73
+    %74 = load ptr, ptr %7
+    %75 = call i64 @task_spawn(ptr @block, ptr %74)
+    %76 = call ptr @alloc(i64 8)
+    store ptr %76, ptr %8
+    %77 = load ptr, ptr %7
+    %78 = getelementptr inbounds ptr, ptr %77, i64 0
+    %79 = load ptr, ptr %78
+    %80 = load ptr, ptr %8
+    %81 = call i1 @chan_recv(ptr %79, ptr %80)
+    %82 = call double @pc_time()
+    %83 = fadd double %82, 0.050000
+    store double %83, ptr %9
+    br label %L13
+L13:
+    %84 = call double @pc_time()
+    %85 = load double, ptr %9
+    %86 = fcmp olt double %84, %85
+    br i1 %86, label %L14, label %L15
+L14:
+    br label %L13
+L15:
+    ret i64 0
+}
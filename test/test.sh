@@ -4,20 +4,45 @@ cd ../build
 cmake ..
 make PorkchopLite -j$(nproc)
 cd ../test
-clang -emit-llvm -S ../lib/lib.c -o lib.ll
+clang -emit-llvm -S ../lib/lib.c -o runtime.ll
 
-# execute
+# modules imported by the tests are compiled on their own and linked with the runtime
+for x in module/*.pc; do
+  echo "compiling module" $x
+  ../build/PorkchopLite $x -o $x.ll -l
+done
+llvm-link -opaque-pointers runtime.ll module/*.pc.ll -S -o lib.ll
+
+# execute, with the environment variables named by a first line of the form "# env: NAME=value"
 for x in *.pc; do
   echo "testing source code" $x
   ../build/PorkchopLite $x -o $x.ll -l &&
   llvm-link -opaque-pointers $x.ll lib.ll -S -o $x.out.ll &&
+  env $(sed -n '1s/^# env: //p' $x) lli -opaque-pointers $x.out.ll > $x.o
+  echo "returned with code" $? >> $x.o
+  echo "succeeded to execute" $x
+done
+
+# runtime checks, each file is compiled with the flags in its first line and ends with a failing check
+for x in check/*.pc; do
+  echo "testing source code" $x
+  ../build/PorkchopLite $x -o $x.ll -l $(head -1 $x | sed 's/^# //') &&
+  llvm-link -opaque-pointers $x.ll lib.ll -S -o $x.out.ll &&
   lli -opaque-pointers $x.out.ll > $x.o
   echo "returned with code" $? >> $x.o
   echo "succeeded to execute" $x
 done
 
+# compile errors, each file is expected to be rejected with the message in its first line
+for x in error/*.pc; do
+  echo "testing source code" $x
+  ../build/PorkchopLite $x -o /dev/null -l 2>&1 | grep -qF "$(head -1 $x | sed 's/^# //')" &&
+  echo "rejected as expected" $x ||
+  echo "failed to reject" $x
+done
+
 # cleanup
-for x in *.pc.out.ll; do
+for x in *.pc.out.ll check/*.pc.out.ll; do
   rm $x
 done
-rm lib.ll
\ No newline at end of file
+rm runtime.ll lib.ll
\ No newline at end of file
@@ -0,0 +1,158 @@
+declare ptr @arena_create(i64 %0) nounwind willreturn norecurse
+declare i64 @thread_create(ptr %0, ptr %1) nounwind
+declare i64 @task_then(i64 %0, ptr %1) nounwind
+declare void @parallel_sort(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare void @parallel_sort_float(ptr %0, i64 %1) nounwind
+declare void @sync_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @parallel_sort_int(ptr %0, i64 %1) nounwind
+declare void @print_i32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_with(ptr %0, i64 %1, i64 %2) nounwind
+declare void @print_int_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare double @reduce_max_float(ptr %0, i64 %1) nounwind
+declare void @printuint(i64 %0) nounwind willreturn norecurse
+declare i64 @task_spawn(ptr %0, ptr %1) nounwind
+declare i1 @chan_send(ptr %0, ptr %1) nounwind
+declare double @reduce_sum_float(ptr %0, i64 %1) nounwind
+declare void @write_int_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare i1 @chan_try_send(ptr %0, ptr %1) nounwind willreturn norecurse
+declare double @reduce_min_float(ptr %0, i64 %1) nounwind
+declare ptr @alloc_aligned(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i64 @reduce_min_int(ptr %0, i64 %1) nounwind
+declare i64 @reduce_sum_int(ptr %0, i64 %1) nounwind
+declare ptr @parallel_for_grain(ptr %0, i64 %1, i64 %2, ptr %3) nounwind
+declare ptr @parallel_for(ptr %0, i64 %1, ptr %2) nounwind
+declare ptr @parallel_reduce(ptr %0, i64 %1, i64 %2, ptr %3, ptr %4) nounwind
+declare void @task_wait_all(ptr %0, ptr %1, i64 %2) nounwind
+declare void @exit(i64 %0) nounwind norecurse
+declare { ptr, i64 } @map_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @printfloat(double %0) nounwind willreturn norecurse
+declare void @print_f32_array(ptr %0, i64 %1) nounwind willreturn norecurse
+declare void @dealloc_aligned(ptr %0) nounwind willreturn norecurse
+declare void @flush_output() nounwind
+declare void @dealloc_huge(ptr %0) nounwind willreturn norecurse
+declare void @write_float_array(i64 %0, ptr %1, i64 %2, i64 %3) nounwind
+declare void @close_file(i64 %0) nounwind willreturn norecurse
+declare i64 @read_int_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @arena_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @read_float_array(i64 %0, ptr %1, i64 %2) nounwind
+declare void @unmap_file({ ptr, i64 } %0) nounwind willreturn norecurse
+declare void @map_advise({ ptr, i64 } %0, i64 %1) nounwind willreturn norecurse
+declare ptr @task_wait(i64 %0) nounwind
+declare double @pc_time() nounwind willreturn norecurse
+declare ptr @alloc_huge(i64 %0) nounwind willreturn norecurse
+declare ptr @chan_create(i64 %0, i64 %1) nounwind willreturn norecurse
+declare i1 @chan_recv(ptr %0, ptr %1) nounwind
+declare i64 @open_file(ptr %0, i1 %1) nounwind willreturn norecurse
+declare void @alloc_stats() nounwind
+declare ptr @arena_local() nounwind willreturn norecurse
+declare void @arena_reset(ptr %0) nounwind willreturn norecurse
+declare void @dealloc(ptr %0) nounwind willreturn norecurse
+declare i64 @reduce_max_int(ptr %0, i64 %1) nounwind
+declare void @chan_destroy(ptr %0) nounwind willreturn norecurse
+declare i64 @thread_count() readnone nounwind willreturn norecurse
+declare ptr @arena_alloc(ptr %0, i64 %1, i64 %2) nounwind willreturn norecurse
+declare i64 @thread_self() readnone nounwind willreturn norecurse
+declare i64 @file_size(ptr %0) nounwind willreturn norecurse
+declare void @chan_close(ptr %0) nounwind willreturn norecurse
+declare ptr @alloc(i64 %0) nounwind willreturn norecurse
+declare void @printint(i64 %0) nounwind willreturn norecurse
+declare ptr @thread_join(i64 %0) nounwind
+define i64 @fnv(ptr %0, i64 %1) readonly nounwind norecurse {
+L0:
+    %2 = alloca ptr
+    store ptr %0, ptr %2
+    %3 = alloca i64
+    store i64 %1, ptr %3
+    %4 = alloca i64
+    %5 = alloca i64
+    store i64 -3750763034362895579, ptr %4
+    store i64 0, ptr %5
+    br label %L1
+L1:
+    %6 = load i64, ptr %5
+    %7 = load i64, ptr %3
+    %8 = icmp slt i64 %6, %7
+    br i1 %8, label %L2, label %L3
+L2:
+    %9 = load i64, ptr %4
+    %10 = load ptr, ptr %2
+    %11 = load i64, ptr %5
+    %12 = getelementptr inbounds i8, ptr %10, i64 %11
+    %13 = load i8, ptr %12
+    %14 = zext i8 %13 to i64
+    %15 = xor i64 %9, %14
+    store i64 %15, ptr %4
+    %16 = load i64, ptr %4
+    %17 = mul i64 %16, 1099511628211
+    store i64 %17, ptr %4
+    %18 = load i64, ptr %5
+    %19 = add nsw i64 %18, 1
+    store i64 %19, ptr %5
+    br label %L1
+L3:
+    %20 = load i64, ptr %4
+    ret i64 %20
+}
+define i32 @mix(i32 %0) readnone nounwind willreturn norecurse {
+L0:
+    %1 = alloca i32
+    store i32 %0, ptr %1
+    %2 = load i32, ptr %1
+    %3 = shl i32 %2, 13
+    %4 = load i32, ptr %1
+    %5 = add i32 %3, %4
+    ret i32 %5
+}
+define i64 @max() readnone nounwind willreturn norecurse {
+L0:
+    ret i64 9223372036854775807
+}
+define i64 @main() nounwind norecurse {
+L0:
+    %0 = alloca i64
+    %1 = alloca ptr
+    %2 = alloca i64
+    store i64 16, ptr %0
+    %3 = load i64, ptr %0
+    %4 = call ptr @alloc(i64 %3)
+    store ptr %4, ptr %1
+    store i64 0, ptr %2
+    br label %L1
+L1:
+    %5 = load i64, ptr %2
+    %6 = load i64, ptr %0
+    %7 = icmp slt i64 %5, %6
+    br i1 %7, label %L2, label %L3
+L2:
+    %8 = load i64, ptr %2
+    %9 = mul nsw i64 %8, 7
+    %10 = trunc i64 %9 to i8
+    %11 = load ptr, ptr %1
+    %12 = load i64, ptr %2
+    %13 = getelementptr inbounds i8, ptr %11, i64 %12
+    store i8 %10, ptr %13
+    %14 = load i64, ptr %2
+    %15 = add nsw i64 %14, 1
+    store i64 %15, ptr %2
+    br label %L1
+L3:
+    %16 = load ptr, ptr %1
+    %17 = load i64, ptr %0
+    %18 = call i64 @fnv(ptr %16, i64 %17)
+    call void @printint(i64 %18)
+    %19 = call i64 @max()
+    %20 = add i64 %19, 1
+    call void @printint(i64 %20)
+    %21 = call i64 @max()
+    %22 = sub nsw i64 0, %21
+    %23 = sub i64 %22, 2
+    call void @printint(i64 %23)
+    %24 = call i32 @mix(i32 1000000)
+    %25 = sext i32 %24 to i64
+    call void @printint(i64 %25)
+    %26 = mul i64 3037000500, 3037000500
+    call void @printint(i64 %26)
+    %27 = load ptr, ptr %1
+    call void @dealloc(ptr %27)
+    ret i64 0
+}
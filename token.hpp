@@ -18,6 +18,7 @@ enum class TokenType {
     KW_WHILE,
     KW_IF,
     KW_ELSE,
+    KW_MATCH,
     KW_FOR,
     KW_FN,
     KW_BREAK,
@@ -73,6 +74,7 @@ enum class TokenType {
     OP_DEC,
     OP_COMMA,
     OP_COLON,
+    OP_AT,
 
     CHARACTER_LITERAL,
     STRING_LITERAL,
@@ -94,6 +96,7 @@ const std::unordered_map<std::string_view, TokenType> KEYWORDS {
     {"while", TokenType::KW_WHILE},
     {"if", TokenType::KW_IF},
     {"else", TokenType::KW_ELSE},
+    {"match", TokenType::KW_MATCH},
     {"for", TokenType::KW_FOR},
     {"fn", TokenType::KW_FN},
     {"break", TokenType::KW_BREAK},
@@ -144,6 +147,7 @@ const std::unordered_map<std::string_view, TokenType> PUNCTUATIONS {
     {"--", TokenType::OP_DEC},
     {",", TokenType::OP_COMMA},
     {":", TokenType::OP_COLON},
+    {"@", TokenType::OP_AT},
     {";", TokenType::LINEBREAK},
     {"(", TokenType::LPAREN},
     {")", TokenType::RPAREN},
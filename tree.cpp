@@ -4,6 +4,7 @@
 #include "diagnostics.hpp"
 #include "lexer.hpp"
 #include "global.hpp"
+#include "interpreter.hpp"
 
 namespace Porkchop {
 
@@ -30,7 +31,7 @@ void Expr::expect(const char *expected) const {
 }
 
 void matchOperands(Expr* lhs, Expr* rhs) {
-    if (!lhs->getType()->equals(rhs->getType())) {
+    if (!lhs->getType()->equals(rhs->getType(lhs->getType()))) {
         Error error;
         error.with(ErrorMessage().error(range(lhs->segment(), rhs->segment())).text("type mismatch on both operands"));
         error.with(ErrorMessage().note(lhs->segment()).text("type of left operand is").type(lhs->getType()));
@@ -52,6 +53,46 @@ void Expr::neverGonnaGiveYouUp(const char* msg) const {
     Porkchop::neverGonnaGiveYouUp(getType(), msg, segment());
 }
 
+TypeReference elementOf(TypeReference const& type) {
+    if (auto slice = dynamic_cast<SliceType*>(type.get())) return slice->E;
+    return dynamic_cast<PointerType*>(type.get())->E;
+}
+
+// traps at runtime unless cond evaluates to expected
+void runtimeCheck(std::string const& cond, bool expected, Compiler& compiler, Assembler* assembler, Token token) {
+    size_t A = compiler.global->labelUntil++;
+    size_t B = compiler.global->labelUntil++;
+    if (expected) {
+        assembler->br(cond, A, B, true);
+    } else {
+        assembler->br(cond, B, A, false);
+    }
+    assembler->label(B);
+    assembler->trap(token);
+    assembler->label(A);
+}
+
+// signed overflow is undefined so that LLVM can widen induction variables and compute trip counts,
+// while -t turns it into a trap; unsigned arithmetic always wraps
+std::string integral(const char* op, std::string const& lhs, std::string const& rhs, const TypeReference& type,
+                     Compiler& compiler, Assembler* assembler, Token token) {
+    if (!isSigned(type)) return assembler->infix(op, lhs, rhs, type, token);
+    if (Assembler::trapv_flag) {
+        if (!strcmp(op, "shl")) {
+            auto result = assembler->infix("shl", lhs, rhs, type, token);
+            auto back = assembler->infix("ashr", result, rhs, type, token);
+            runtimeCheck(assembler->compare("icmp", "eq", back, lhs, type, token), true, compiler, assembler, token);
+            return result;
+        }
+        auto [result, overflowed] = assembler->overflow(op, lhs, rhs, type, token);
+        runtimeCheck(overflowed, false, compiler, assembler, token);
+        return result;
+    }
+    char nsw[16];
+    sprintf(nsw, "%s nsw", op);
+    return assembler->infix(nsw, lhs, rhs, type, token);
+}
+
 $union Expr::requireConst() const {
     if (!isConst()) raise("cannot evaluate at compile-time", segment());
     return constValue;
@@ -95,6 +136,9 @@ CharConstExpr::CharConstExpr(Compiler &compiler, Token token) : ConstExpr(compil
 }
 
 TypeReference CharConstExpr::evalType(TypeReference const& infer) const {
+    if (infer && isIntegral(infer) && truncate(infer, (int64_t) parsed).$int == parsed) {
+        return infer;
+    }
     return ScalarTypes::INT;
 }
 
@@ -123,6 +167,9 @@ IntConstExpr::IntConstExpr(Compiler &compiler, Token token, bool merged) : Const
 }
 
 TypeReference IntConstExpr::evalType(TypeReference const& infer) const {
+    if (infer && isIntegral(infer) && truncate(infer, parsed).$int == parsed && !(isUnsigned(infer) && parsed < 0)) {
+        return infer;
+    }
     return ScalarTypes::INT;
 }
 
@@ -139,15 +186,18 @@ FloatConstExpr::FloatConstExpr(Compiler &compiler, Token token) : ConstExpr(comp
 }
 
 TypeReference FloatConstExpr::evalType(TypeReference const& infer) const {
+    if (infer && isFloating(infer)) {
+        return infer;
+    }
     return ScalarTypes::FLOAT;
 }
 
 void FloatConstExpr::walkBytecode(Assembler* assembler) const {
-     reg = assembler->const_(parsed);
+     reg = assembler->const_(parsed, getType());
 }
 
 std::optional<$union> FloatConstExpr::evalConst() const {
-    return parsed;
+    return truncate(getType(), parsed);
 }
 
 TypeReference IdExpr::evalType(TypeReference const& infer) const {
@@ -158,6 +208,50 @@ void SizeofExpr::walkBytecode(Porkchop::Assembler *assembler) const {
     reg = assembler->const_(type->size());
 }
 
+TypeReference ArrayExpr::evalType(TypeReference const& infer) const {
+    if (elements.empty()) raise("empty array is not supported", segment());
+    TypeReference element;
+    if (auto ptr = dynamic_cast<PointerType*>(infer.get())) {
+        element = ptr->E;
+    }
+    elements.front()->getType(element);
+    auto type = ensureElements(elements, segment(), "for elements of an array");
+    if (!isBool(type) && !isArithmetic(type)) {
+        elements.front()->expect("bool or arithmetic type");
+    }
+    for (auto&& e : elements) {
+        e->requireConst();
+    }
+    return std::make_shared<PointerType>(type);
+}
+
+std::string ArrayExpr::definition(Assembler* assembler) const {
+    auto type = elementOf(getType());
+    auto name = type->serialize();
+    auto size = type->size() * (int64_t) elements.size();
+    char buf[64];
+    sprintf(buf, "unnamed_addr constant [%zu x %s] [", elements.size(), name.data());
+    std::string definition = buf;
+    bool first = true;
+    for (auto&& e : elements) {
+        if (first) first = false; else definition += ", ";
+        definition += name;
+        definition += " ";
+        definition += assembler->const_(e->requireConst(), type);
+    }
+    // align tables for vector loads as clang does
+    sprintf(buf, "], align %d", (int) std::max(type->size(), size >= 16 ? int64_t(16) : int64_t(1)));
+    definition += buf;
+    return definition;
+}
+
+void ArrayExpr::walkBytecode(Assembler* assembler) const {
+    char buf[24];
+    sprintf(buf, "@.array.%zu", assembler->arrays++);
+    reg = buf;
+    assembler->declarations.emplace(reg + " = private " + definition(assembler));
+}
+
 void AssignableExpr::walkBytecode(Porkchop::Assembler *assembler) const {
     auto seg = segment();
     Token token{.line = seg.line1, .column = seg.column1};
@@ -173,20 +267,69 @@ void AssignableExpr::walkStoreBytecode(const std::string &from, Assembler *assem
 std::optional<$union> IdExpr::evalConst() const {
     if (compiler.of(token) == "_")
         return nullptr;
+    if (auto let = importedLet()) {
+        return let->value;
+    }
     return Expr::evalConst();
 }
 
+const ExportedLet* IdExpr::importedLet() const {
+    if (lookup.scope != LocalContext::LookupResult::Scope::GLOBAL) return nullptr;
+    auto it = compiler.global->importedLets.find(std::string(compiler.of(token)));
+    return it == compiler.global->importedLets.end() ? nullptr : &it->second;
+}
+
+bool IdExpr::isConstantArray() const {
+    return lookup.scope == LocalContext::LookupResult::Scope::GLOBAL && compiler.global->arrays.contains(std::string(compiler.of(token)));
+}
+
+// like originOf, but follows pointer arithmetic and slicing at any offset, since every element of a constant array is read-only
+bool pointsIntoConstantArray(const Expr* expr) {
+    if (dynamic_cast<const ArrayExpr*>(expr)) return true;
+    if (auto id = dynamic_cast<const IdExpr*>(expr)) {
+        return id->isConstantArray() || id->lookup.array;
+    }
+    if (auto as = dynamic_cast<const AsExpr*>(expr); as && (isPointer(as->lhs->getType()) || isSlice(as->lhs->getType()))) {
+        return pointsIntoConstantArray(as->lhs.get());
+    }
+    if (auto infix = dynamic_cast<const InfixExpr*>(expr); infix && isPointer(infix->getType())) {
+        return pointsIntoConstantArray(isPointer(infix->lhs->getType()) ? infix->lhs.get() : infix->rhs.get());
+    }
+    if (auto slice = dynamic_cast<const SliceExpr*>(expr)) {
+        return pointsIntoConstantArray(slice->lhs.get());
+    }
+    if (auto address = dynamic_cast<const AddressOfExpr*>(expr)) {
+        if (auto access = dynamic_cast<const AccessExpr*>(address->rhs.get())) {
+            return pointsIntoConstantArray(access->lhs.get());
+        }
+        if (auto dereference = dynamic_cast<const DereferenceExpr*>(address->rhs.get())) {
+            return pointsIntoConstantArray(dereference->rhs.get());
+        }
+    }
+    return false;
+}
+
 void IdExpr::ensureAssignable() const {
     if (lookup.scope == LocalContext::LookupResult::Scope::GLOBAL && isFunction(getType())) {
         raise("function is not assignable", segment());
     }
+    if (isConstantArray() || lookup.array) {
+        raise("constant array is not assignable", segment());
+    }
+    if (auto let = importedLet(); let && let->value) {
+        raise("imported constant is not assignable", segment());
+    }
 }
 
 void IdExpr::walkBytecode(Porkchop::Assembler *assembler) const {
-    if (lookup.scope == LocalContext::LookupResult::Scope::GLOBAL && isFunction(getType())) {
+    if ((lookup.scope == LocalContext::LookupResult::Scope::GLOBAL && isFunction(getType())) || isConstantArray()) {
         reg = Assembler::escape(compiler.of(token));
         return;
     }
+    if (auto let = importedLet(); let && let->value) {
+        reg = assembler->const_(*let->value, getType());
+        return;
+    }
     AssignableExpr::walkBytecode(assembler);
 }
 
@@ -214,7 +357,7 @@ TypeReference PrefixExpr::evalType(TypeReference const& infer) const {
             rhs->expect(ScalarTypes::BOOL);
             break;
         case TokenType::OP_INV:
-            rhs->expect(ScalarTypes::INT);
+            rhs->expect(isIntegral, "integral type");
             break;
         default:
             unreachable();
@@ -223,24 +366,27 @@ TypeReference PrefixExpr::evalType(TypeReference const& infer) const {
 }
 
 std::optional<$union> PrefixExpr::evalConst() const {
-    auto type = rhs->getType();
     if (!rhs->isConst()) return std::nullopt;
-    auto value = rhs->requireConst();
+    return apply(rhs->requireConst());
+}
+
+$union PrefixExpr::apply($union value) const {
+    auto type = rhs->getType();
     switch (token.type) {
         case TokenType::OP_ADD:
             return value;
         case TokenType::OP_SUB:
-            if (isInt(type)) {
-                return -value.$int;
+            if (isIntegral(type)) {
+                return truncate(type, -value.$int);
             } else {
-                return -value.$float;
+                return truncate(type, -value.$float);
             }
         case TokenType::OP_NOT:
             return !value.$bool;
         case TokenType::OP_INV:
-            return ~value.$int;
+            return truncate(type, ~value.$int);
         default:
-            return Expr::evalConst();
+            unreachable();
     }
 }
 
@@ -252,7 +398,9 @@ void PrefixExpr::walkBytecode(Assembler* assembler) const {
             reg = rhs->reg;
             break;
         case TokenType::OP_SUB: {
-            reg = assembler->neg(rhs->reg, getType(), token);
+            reg = isIntegral(type)
+                    ? integral("sub", "0", rhs->reg, type, compiler, assembler, token)
+                    : assembler->neg(rhs->reg, type, token);
             break;
         }
         case TokenType::OP_NOT: {
@@ -270,6 +418,14 @@ void PrefixExpr::walkBytecode(Assembler* assembler) const {
 
 TypeReference AddressOfExpr::evalType(const TypeReference &infer) const {
     rhs->neverGonnaGiveYouUp("to take address");
+    if (auto id = dynamic_cast<const IdExpr*>(rhs.get())) {
+        if (id->isConstantArray()) {
+            raise("constant array is already an address", segment());
+        }
+        if (auto let = id->importedLet(); let && let->value) {
+            raise("cannot take address of an imported constant", segment());
+        }
+    }
     return std::make_shared<PointerType>(rhs->getType());
 }
 
@@ -288,7 +444,9 @@ TypeReference DereferenceExpr::evalType(const TypeReference &infer) const {
 }
 
 void DereferenceExpr::ensureAssignable() const {
-
+    if (pointsIntoConstantArray(rhs.get())) {
+        raise("constant array is not assignable", segment());
+    }
 }
 
 std::string DereferenceExpr::addressOf(Assembler *assembler) const {
@@ -299,8 +457,11 @@ std::string DereferenceExpr::addressOf(Assembler *assembler) const {
 TypeReference StatefulPrefixExpr::evalType(TypeReference const& infer) const {
     rhs->ensureAssignable();
     auto type = rhs->getType();
-    if (!isInt(type) && !isPointer(type)) {
-        rhs->expect("int or pointer type");
+    if (!isIntegral(type) && !isPointer(type)) {
+        rhs->expect("integral or pointer type");
+    }
+    if (isPointer(type) && isNone(elementOf(type))) {
+        raise("none* cannot get involved in pointer arithmetics", segment());
     }
     return type;
 }
@@ -309,10 +470,10 @@ void StatefulPrefixExpr::walkBytecode(Assembler* assembler) const {
     auto one = token.type == TokenType::OP_INC ? "1" : "-1";
     rhs->walkBytecode(assembler);
     auto type = rhs->getType();
-    if (isInt(type)) {
-        reg = assembler->infix("add", rhs->reg, one, type, token);
+    if (isIntegral(type)) {
+        reg = integral("add", rhs->reg, one, type, compiler, assembler, token);
     } else {
-        reg = assembler->offset(rhs->reg, one, type, token);
+        reg = assembler->offset(rhs->reg, one, elementOf(type), token);
     }
     rhs->walkStoreBytecode(reg, assembler);
 }
@@ -320,8 +481,11 @@ void StatefulPrefixExpr::walkBytecode(Assembler* assembler) const {
 TypeReference StatefulPostfixExpr::evalType(TypeReference const& infer) const {
     lhs->ensureAssignable();
     auto type = lhs->getType();
-    if (!isInt(type) && !isPointer(type)) {
-        lhs->expect("int or pointer type");
+    if (!isIntegral(type) && !isPointer(type)) {
+        lhs->expect("integral or pointer type");
+    }
+    if (isPointer(type) && isNone(elementOf(type))) {
+        raise("none* cannot get involved in pointer arithmetics", segment());
     }
     return type;
 }
@@ -331,15 +495,15 @@ void StatefulPostfixExpr::walkBytecode(Assembler* assembler) const {
     auto type = lhs->getType();
     lhs->walkBytecode(assembler);
     lhs->walkStoreBytecode(
-            isInt(type)
-            ? assembler->infix("add", lhs->reg, one, type, token)
-            : assembler->offset(lhs->reg, one, type, token),
+            isIntegral(type)
+            ? integral("add", lhs->reg, one, type, compiler, assembler, token)
+            : assembler->offset(lhs->reg, one, elementOf(type), token),
             assembler);
     reg = lhs->reg;
 }
 
 TypeReference InfixExpr::evalType(TypeReference const& infer) const {
-    auto type1 = lhs->getType(), type2 = rhs->getType();
+    auto type1 = lhs->getType(), type2 = rhs->getType(type1);
     if (auto ptr = dynamic_cast<PointerType*>(type1.get()); ptr && token.type == TokenType::OP_SUB && type1->equals(type2)) {
         if (isNone(ptr->E)) {
             raise("none* cannot get involved in pointer arithmetics", segment());
@@ -350,14 +514,11 @@ TypeReference InfixExpr::evalType(TypeReference const& infer) const {
         case TokenType::OP_OR:
         case TokenType::OP_XOR:
         case TokenType::OP_AND:
-            lhs->expect(ScalarTypes::INT);
-            matchOperands(lhs.get(), rhs.get());
-            return type1;
         case TokenType::OP_SHL:
         case TokenType::OP_SHR:
         case TokenType::OP_USHR:
-            lhs->expect(ScalarTypes::INT);
-            rhs->expect(ScalarTypes::INT);
+            lhs->expect(isIntegral, "integral type");
+            matchOperands(lhs.get(), rhs.get());
             return type1;
         case TokenType::OP_ADD:
             if (auto ptr = dynamic_cast<PointerType*>(type2.get()); ptr && isInt(type1)) {
@@ -386,53 +547,68 @@ TypeReference InfixExpr::evalType(TypeReference const& infer) const {
 
 std::optional<$union> InfixExpr::evalConst() const {
     if (!lhs->isConst() || !rhs->isConst()) return std::nullopt;
-    auto value1 = lhs->requireConst(), value2 = rhs->requireConst();
-    switch (token.type) {
+    return apply(token.type, lhs->getType(), lhs->requireConst(), rhs->requireConst(), segment());
+}
+
+$union InfixExpr::apply(TokenType op, TypeReference const& type, $union value1, $union value2, Segment segment) {
+    bool i = isIntegral(type), u = isUnsigned(type);
+    switch (op) {
         case TokenType::OP_OR:
-            return value1.$size | value2.$size;
+            return truncate(type, value1.$size | value2.$size);
         case TokenType::OP_XOR:
-            return value1.$size ^ value2.$size;
+            return truncate(type, value1.$size ^ value2.$size);
         case TokenType::OP_AND:
-            return value1.$size & value2.$size;
+            return truncate(type, value1.$size & value2.$size);
         case TokenType::OP_SHL:
-            return value1.$int << value2.$int;
+            return truncate(type, value1.$size << value2.$int);
         case TokenType::OP_SHR:
-            return value1.$int >> value2.$int;
-        case TokenType::OP_USHR:
-            return value1.$size >> value2.$int;
+            if (u) {
+                return value1.$size >> value2.$int;
+            } else {
+                return value1.$int >> value2.$int;
+            }
+        case TokenType::OP_USHR: {
+            size_t bits = value1.$size;
+            if (type->size() < 8) bits &= (size_t(1) << type->size() * 8) - 1;
+            return truncate(type, bits >> value2.$int);
+        }
         case TokenType::OP_ADD:
-            if (isInt(lhs->getType())) {
-                return value1.$int + value2.$int;
+            if (i) {
+                return truncate(type, value1.$size + value2.$size);
             } else {
-                return value1.$float + value2.$float;
+                return truncate(type, value1.$float + value2.$float);
             }
         case TokenType::OP_SUB:
-            if (isInt(lhs->getType())) {
-                return value1.$int - value2.$int;
+            if (i) {
+                return truncate(type, value1.$size - value2.$size);
             } else {
-                return value1.$float - value2.$float;
+                return truncate(type, value1.$float - value2.$float);
             }
         case TokenType::OP_MUL:
-            if (isInt(lhs->getType())) {
-                return value1.$int * value2.$int;
+            if (i) {
+                return truncate(type, value1.$size * value2.$size);
             } else {
-                return value1.$float * value2.$float;
+                return truncate(type, value1.$float * value2.$float);
             }
         case TokenType::OP_DIV:
-            if (isInt(lhs->getType())) {
+            if (i) {
                 int64_t divisor = value2.$int;
-                if (divisor == 0) raise("divided by zero", segment());
-                return value1.$int / divisor;
+                if (divisor == 0) raise("divided by zero", segment);
+                if (u) return value1.$size / value2.$size;
+                if (value1.$int == INT64_MIN && divisor == -1) raise("division overflow", segment);
+                return truncate(type, value1.$int / divisor);
             } else {
-                return value1.$float / value2.$float;
+                return truncate(type, value1.$float / value2.$float);
             }
         case TokenType::OP_REM:
-            if (isInt(lhs->getType())) {
+            if (i) {
                 int64_t divisor = value2.$int;
-                if (divisor == 0) raise("divided by zero", segment());
+                if (divisor == 0) raise("divided by zero", segment);
+                if (u) return value1.$size % value2.$size;
+                if (value1.$int == INT64_MIN && divisor == -1) raise("division overflow", segment);
                 return value1.$int % divisor;
             } else {
-                return std::fmod(value1.$float, value2.$float);
+                return truncate(type, std::fmod(value1.$float, value2.$float));
             }
         default:
             unreachable();
@@ -442,7 +618,7 @@ std::optional<$union> InfixExpr::evalConst() const {
 void InfixExpr::walkBytecode(Assembler* assembler) const {
     lhs->walkBytecode(assembler);
     rhs->walkBytecode(assembler);
-    bool i = isInt(lhs->getType());
+    bool i = isIntegral(lhs->getType()), u = isUnsigned(lhs->getType());
     auto type1 = lhs->getType(), type2 = rhs->getType();
     if (auto ptr = dynamic_cast<PointerType*>(type1.get()); ptr && token.type == TokenType::OP_SUB && type1->equals(type2)) {
         auto ptr1 = assembler->cast("ptrtoint", lhs->reg, type1, ScalarTypes::INT, token);
@@ -463,38 +639,41 @@ void InfixExpr::walkBytecode(Assembler* assembler) const {
             reg = assembler->infix("and", lhs->reg, rhs->reg, getType(), token);
             break;
         case TokenType::OP_SHL:
-            reg = assembler->infix("shl", lhs->reg, rhs->reg, getType(), token);
+            reg = integral("shl", lhs->reg, rhs->reg, getType(), compiler, assembler, token);
             break;
         case TokenType::OP_SHR:
-            reg = assembler->infix("ashr", lhs->reg, rhs->reg, getType(), token);
+            reg = assembler->infix(u ? "lshr" : "ashr", lhs->reg, rhs->reg, getType(), token);
             break;
         case TokenType::OP_USHR:
             reg = assembler->infix("lshr", lhs->reg, rhs->reg, getType(), token);
             break;
         case TokenType::OP_ADD:
             if (isInt(type1) && isPointer(type2)) {
-                reg = assembler->offset(rhs->reg, lhs->reg, getType(), token);
+                reg = assembler->offset(rhs->reg, lhs->reg, elementOf(getType()), token);
             } else if (isInt(type2) && isPointer(type1)) {
-                reg = assembler->offset(lhs->reg, rhs->reg, getType(), token);
+                reg = assembler->offset(lhs->reg, rhs->reg, elementOf(getType()), token);
             } else {
-                reg = assembler->infix(i ? "add" : "fadd", lhs->reg, rhs->reg, getType(), token);
+                reg = i ? integral("add", lhs->reg, rhs->reg, getType(), compiler, assembler, token)
+                        : assembler->infix("fadd", lhs->reg, rhs->reg, getType(), token);
             }
             break;
         case TokenType::OP_SUB:
             if (isInt(type2) && isPointer(type1)) {
-                reg = assembler->offset(lhs->reg, assembler->neg(rhs->reg, rhs->getType(), token), getType(), token);
+                reg = assembler->offset(lhs->reg, assembler->neg(rhs->reg, rhs->getType(), token), elementOf(getType()), token);
             } else {
-                reg = assembler->infix(i ? "sub" : "fsub", lhs->reg, rhs->reg, getType(), token);
+                reg = i ? integral("sub", lhs->reg, rhs->reg, getType(), compiler, assembler, token)
+                        : assembler->infix("fsub", lhs->reg, rhs->reg, getType(), token);
             }
             break;
         case TokenType::OP_MUL:
-            reg = assembler->infix(i ? "mul" : "fmul", lhs->reg, rhs->reg, getType(), token);
+            reg = i ? integral("mul", lhs->reg, rhs->reg, getType(), compiler, assembler, token)
+                    : assembler->infix("fmul", lhs->reg, rhs->reg, getType(), token);
             break;
         case TokenType::OP_DIV:
-            reg = assembler->infix(i ? "sdiv" : "fdiv", lhs->reg, rhs->reg, getType(), token);
+            reg = assembler->infix(i ? u ? "udiv" : "sdiv" : "fdiv", lhs->reg, rhs->reg, getType(), token);
             break;
         case TokenType::OP_REM:
-            reg = assembler->infix(i ? "srem" : "frem", lhs->reg, rhs->reg, getType(), token);
+            reg = assembler->infix(i ? u ? "urem" : "srem" : "frem", lhs->reg, rhs->reg, getType(), token);
             break;
         default:
             unreachable();
@@ -513,6 +692,9 @@ TypeReference CompareExpr::evalType(TypeReference const& infer) const {
             raise("function type only support equality operators", segment());
         }
     }
+    if (isSlice(type)) {
+        raise("slice does not support comparison", segment());
+    }
     return ScalarTypes::BOOL;
 }
 
@@ -520,11 +702,15 @@ std::optional<$union> CompareExpr::evalConst() const {
     auto type = lhs->getType();
     if (isNone(type)) return token.type == TokenType::OP_EQ;
     if (!lhs->isConst() || !rhs->isConst()) return std::nullopt;
-    auto value1 = lhs->requireConst(), value2 = rhs->requireConst();
+    return apply(lhs->requireConst(), rhs->requireConst());
+}
+
+$union CompareExpr::apply($union value1, $union value2) const {
+    auto type = lhs->getType();
     std::partial_ordering cmp = value1.$size <=> value2.$size;
-    if (isInt(type)) {
+    if (isSigned(type)) {
         cmp = value1.$int <=> value2.$int;
-    } else if (isFloat(type)) {
+    } else if (isFloating(type)) {
         cmp = value1.$float <=> value2.$float;
     }
     switch (token.type) {
@@ -554,8 +740,8 @@ void CompareExpr::walkBytecode(Assembler *assembler) const {
     lhs->walkBytecode(assembler);
     rhs->walkBytecode(assembler);
     const char* op1 = "", *op2 = "";
-    if (!isFloat(lhs->getType())) {
-        bool p = isPointer(type);
+    if (!isFloating(lhs->getType())) {
+        bool u = isPointer(type) || isUnsigned(type);
         op1 = "icmp";
         switch (token.type) {
             case TokenType::OP_EQ:
@@ -565,16 +751,16 @@ void CompareExpr::walkBytecode(Assembler *assembler) const {
                 op2 = "ne";
                 break;
             case TokenType::OP_LT:
-                op2 = p ? "ult" : "slt";
+                op2 = u ? "ult" : "slt";
                 break;
             case TokenType::OP_LE:
-                op2 = p ? "ule" : "sle";
+                op2 = u ? "ule" : "sle";
                 break;
             case TokenType::OP_GT:
-                op2 = p ? "ugt" : "sgt";
+                op2 = u ? "ugt" : "sgt";
                 break;
             case TokenType::OP_GE:
-                op2 = p ? "uge" : "sge";
+                op2 = u ? "uge" : "sge";
                 break;
             default:
                 unreachable();
@@ -654,11 +840,16 @@ TypeReference InfixInvokeExpr::evalType(TypeReference const& infer) const {
             error.with(ErrorMessage().note(infix->segment()).text("type of this function is").type(infix->getType()));
             error.raise();
         }
+        InvokeExpr::checkRestrict(func, {lhs.get(), rhs.get()});
         return func->R;
     }
     infix->expect("invocable type");
 }
 
+std::optional<$union> InfixInvokeExpr::evalConst() const {
+    return InvokeExpr::evalConst(infix.get(), {lhs.get(), rhs.get()});
+}
+
 void InfixInvokeExpr::walkBytecode(Assembler *assembler) const {
     reg = InvokeExpr::walkBytecode(infix.get(), {lhs.get(), rhs.get()}, assembler, getType(), token, token);
 }
@@ -673,18 +864,18 @@ TypeReference AssignExpr::evalType(TypeReference const& infer) const {
         case TokenType::OP_ASSIGN_AND:
         case TokenType::OP_ASSIGN_XOR:
         case TokenType::OP_ASSIGN_OR:
-            lhs->expect(ScalarTypes::INT);
-            rhs->expect(type1);
-            return type1;
         case TokenType::OP_ASSIGN_SHL:
         case TokenType::OP_ASSIGN_SHR:
         case TokenType::OP_ASSIGN_USHR:
-            lhs->expect(ScalarTypes::INT);
-            rhs->expect(ScalarTypes::INT);
+            lhs->expect(isIntegral, "integral type");
+            rhs->expect(type1);
             return type1;
         case TokenType::OP_ASSIGN_ADD:
         case TokenType::OP_ASSIGN_SUB:
             if (isPointer(type1)) {
+                if (isNone(elementOf(type1))) {
+                    raise("none* cannot get involved in pointer arithmetics", segment());
+                }
                 rhs->expect(ScalarTypes::INT);
                 return type1;
             }
@@ -706,7 +897,8 @@ void AssignExpr::walkBytecode(Assembler* assembler) const {
     } else {
         lhs->walkBytecode(assembler);
         rhs->walkBytecode(assembler);
-        bool i = isInt(lhs->getType());
+        bool i = isIntegral(lhs->getType());
+        bool u = isUnsigned(lhs->getType());
         bool p = isPointer(lhs->getType());
         switch (token.type) {
             case TokenType::OP_ASSIGN_OR:
@@ -719,36 +911,39 @@ void AssignExpr::walkBytecode(Assembler* assembler) const {
                 reg = assembler->infix("and", lhs->reg, rhs->reg, getType(), token);
                 break;
             case TokenType::OP_ASSIGN_SHL:
-                reg = assembler->infix("shl", lhs->reg, rhs->reg, getType(), token);
+                reg = integral("shl", lhs->reg, rhs->reg, getType(), compiler, assembler, token);
                 break;
             case TokenType::OP_ASSIGN_SHR:
-                reg = assembler->infix("ashr", lhs->reg, rhs->reg, getType(), token);
+                reg = assembler->infix(u ? "lshr" : "ashr", lhs->reg, rhs->reg, getType(), token);
                 break;
             case TokenType::OP_ASSIGN_USHR:
                 reg = assembler->infix("lshr", lhs->reg, rhs->reg, getType(), token);
                 break;
             case TokenType::OP_ASSIGN_ADD:
                 if (p) {
-                    reg = assembler->offset(lhs->reg, rhs->reg, getType(), token);
+                    reg = assembler->offset(lhs->reg, rhs->reg, elementOf(getType()), token);
                 } else {
-                    reg = assembler->infix(i ? "add" : "fadd", lhs->reg, rhs->reg, getType(), token);
+                    reg = i ? integral("add", lhs->reg, rhs->reg, getType(), compiler, assembler, token)
+                            : assembler->infix("fadd", lhs->reg, rhs->reg, getType(), token);
                 }
                 break;
             case TokenType::OP_ASSIGN_SUB:
                 if (p) {
-                    reg = assembler->offset(lhs->reg, assembler->neg(rhs->reg, rhs->getType(), token), getType(), token);
+                    reg = assembler->offset(lhs->reg, assembler->neg(rhs->reg, rhs->getType(), token), elementOf(getType()), token);
                 } else {
-                    reg = assembler->infix(i ? "sub" : "fsub", lhs->reg, rhs->reg, getType(), token);
+                    reg = i ? integral("sub", lhs->reg, rhs->reg, getType(), compiler, assembler, token)
+                            : assembler->infix("fsub", lhs->reg, rhs->reg, getType(), token);
                 }
                 break;
             case TokenType::OP_ASSIGN_MUL:
-                reg = assembler->infix(i ? "mul" : "fmul", lhs->reg, rhs->reg, getType(), token);
+                reg = i ? integral("mul", lhs->reg, rhs->reg, getType(), compiler, assembler, token)
+                        : assembler->infix("fmul", lhs->reg, rhs->reg, getType(), token);
                 break;
             case TokenType::OP_ASSIGN_DIV:
-                reg = assembler->infix(i ? "sdiv" : "fdiv", lhs->reg, rhs->reg, getType(), token);
+                reg = assembler->infix(i ? u ? "udiv" : "sdiv" : "fdiv", lhs->reg, rhs->reg, getType(), token);
                 break;
             case TokenType::OP_ASSIGN_REM:
-                reg = assembler->infix(i ? "srem" : "frem", lhs->reg, rhs->reg, getType(), token);
+                reg = assembler->infix(i ? u ? "urem" : "srem" : "frem", lhs->reg, rhs->reg, getType(), token);
                 break;
             default:
                 unreachable();
@@ -763,17 +958,72 @@ TypeReference AccessExpr::evalType(TypeReference const& infer) const {
     if (auto ptr = dynamic_cast<PointerType*>(type.get())) {
         return ptr->E;
     }
-    lhs->expect("pointer type");
+    if (auto slice = dynamic_cast<SliceType*>(type.get())) {
+        return slice->E;
+    }
+    lhs->expect("pointer or slice type");
 }
 
 void AccessExpr::ensureAssignable() const {
-
+    if (pointsIntoConstantArray(lhs.get())) {
+        raise("constant array is not assignable", segment());
+    }
 }
 
 std::string AccessExpr::addressOf(Assembler *assembler) const {
     lhs->walkBytecode(assembler);
     rhs->walkBytecode(assembler);
-    return assembler->offset(lhs->reg, rhs->reg, getType(), token1);
+    auto type = lhs->getType();
+    if (!isSlice(type)) return assembler->offset(lhs->reg, rhs->reg, getType(), token1);
+    if (Assembler::bounds_flag) {
+        // a negative index wraps around to a huge unsigned one
+        auto length = assembler->extract(lhs->reg, type, 1, token1);
+        runtimeCheck(assembler->compare("icmp", "ult", rhs->reg, length, ScalarTypes::INT, token1), true, compiler, assembler, token1);
+    }
+    auto ptr = assembler->extract(lhs->reg, type, 0, token1);
+    return assembler->offset(ptr, rhs->reg, getType(), token1);
+}
+
+TypeReference SliceExpr::evalType(TypeReference const& infer) const {
+    auto type = lhs->getType();
+    if (begin) begin->expect(ScalarTypes::INT);
+    if (end) end->expect(ScalarTypes::INT);
+    if (isSlice(type)) return type;
+    if (auto ptr = dynamic_cast<PointerType*>(type.get())) {
+        if (isNone(ptr->E)) raise("none* cannot be sliced", lhs->segment());
+        if (!end) raise("the end of a slice from pointer must be specified", segment());
+        return std::make_shared<SliceType>(ptr->E);
+    }
+    lhs->expect("pointer or slice type");
+}
+
+void SliceExpr::walkBytecode(Assembler* assembler) const {
+    lhs->walkBytecode(assembler);
+    if (begin) begin->walkBytecode(assembler);
+    if (end) end->walkBytecode(assembler);
+    auto type = lhs->getType();
+    bool slice = isSlice(type);
+    std::string ptr = lhs->reg, length;
+    if (slice) {
+        ptr = assembler->extract(lhs->reg, type, 0, token1);
+        length = assembler->extract(lhs->reg, type, 1, token1);
+    }
+    std::string from = begin ? begin->reg : "0";
+    std::string to = end ? end->reg : length;
+    if (Assembler::bounds_flag) {
+        // 0 <= begin <= end <= length for a slice, where unsigned comparisons reject negative indices at once
+        auto inbounds = assembler->compare("icmp", slice ? "ule" : "sle", from, to, ScalarTypes::INT, token1);
+        if (slice && end) {
+            auto within = assembler->compare("icmp", "ule", to, length, ScalarTypes::INT, token1);
+            inbounds = assembler->infix("and", inbounds, within, ScalarTypes::BOOL, token1);
+        }
+        runtimeCheck(inbounds, true, compiler, assembler, token1);
+    }
+    if (begin) {
+        ptr = assembler->offset(ptr, from, elementOf(type), token1);
+        to = assembler->infix("sub", to, from, ScalarTypes::INT, token1);
+    }
+    reg = assembler->slice(ptr, to, token1);
 }
 
 TypeReference InvokeExpr::evalType(TypeReference const& infer) const {
@@ -792,11 +1042,101 @@ TypeReference InvokeExpr::evalType(TypeReference const& infer) const {
                 error.raise();
             }
         }
+        std::vector<const Expr*> params;
+        for (auto&& e : rhs) {
+            params.push_back(e.get());
+        }
+        checkRestrict(func, params);
         return func->R;
     }
     lhs->expect("invocable type");
 }
 
+std::optional<$union> InvokeExpr::evalConst() const {
+    std::vector<const Expr*> params;
+    for (auto&& e : rhs) {
+        params.push_back(e.get());
+    }
+    return evalConst(lhs.get(), params);
+}
+
+std::optional<$union> InvokeExpr::evalConst(const Expr* lhs, std::vector<const Expr*> const& rhs) {
+    std::vector<$union> args;
+    for (auto&& e : rhs) {
+        if (!e->isConst()) return std::nullopt;
+        args.push_back(e->requireConst());
+    }
+    return Interpreter::evaluate(lhs->compiler.global, lhs, args);
+}
+
+struct PointerOrigin {
+    const IdExpr* base;
+    int64_t offset; // in bytes
+
+    [[nodiscard]] bool operator==(PointerOrigin const& other) const noexcept {
+        if (offset != other.offset || base->lookup.scope != other.base->lookup.scope) return false;
+        switch (base->lookup.scope) {
+            case LocalContext::LookupResult::Scope::LOCAL:
+                return base->lookup.index == other.base->lookup.index;
+            case LocalContext::LookupResult::Scope::GLOBAL:
+                return base->compiler.of(base->token) == other.base->compiler.of(other.base->token);
+            default:
+                return false;
+        }
+    }
+};
+
+// traces a pointer expression back to a variable plus a constant offset, if that is obvious
+std::optional<PointerOrigin> originOf(const Expr* expr) {
+    if (auto id = dynamic_cast<const IdExpr*>(expr)) {
+        return PointerOrigin{id, 0};
+    }
+    if (auto as = dynamic_cast<const AsExpr*>(expr); as && isPointer(as->lhs->getType())) {
+        return originOf(as->lhs.get());
+    }
+    if (auto infix = dynamic_cast<const InfixExpr*>(expr); infix && isPointer(infix->getType())) {
+        bool sub = infix->token.type == TokenType::OP_SUB;
+        const Expr* ptr = infix->lhs.get();
+        const Expr* idx = infix->rhs.get();
+        if (isPointer(idx->getType())) std::swap(ptr, idx);
+        auto origin = originOf(ptr);
+        if (!origin || !idx->isConst()) return std::nullopt;
+        int64_t offset = idx->requireConst().$int * elementOf(infix->getType())->size();
+        origin->offset += sub ? -offset : offset;
+        return origin;
+    }
+    if (auto address = dynamic_cast<const AddressOfExpr*>(expr)) {
+        if (auto access = dynamic_cast<const AccessExpr*>(address->rhs.get())) {
+            auto origin = originOf(access->lhs.get());
+            if (!origin || !access->rhs->isConst()) return std::nullopt;
+            origin->offset += access->rhs->requireConst().$int * access->getType()->size();
+            return origin;
+        }
+        if (auto dereference = dynamic_cast<const DereferenceExpr*>(address->rhs.get())) {
+            return originOf(dereference->rhs.get());
+        }
+    }
+    return std::nullopt;
+}
+
+void InvokeExpr::checkRestrict(FuncType const* func, std::vector<const Expr*> const& rhs) {
+    if (func->restricts.empty()) return;
+    for (size_t i = 0; i < rhs.size(); ++i) {
+        if (!func->isRestrict(i)) continue;
+        auto origin1 = originOf(rhs[i]);
+        if (!origin1) continue;
+        for (size_t j = 0; j < rhs.size(); ++j) {
+            if (i == j || !isPointer(func->P[j])) continue;
+            if (auto origin2 = originOf(rhs[j]); origin2 && *origin1 == *origin2) {
+                Error error;
+                error.with(ErrorMessage().error(rhs[i]->segment()).text("restrict pointer argument aliases another argument"));
+                error.with(ErrorMessage().note(rhs[j]->segment()).text("which points to the same address"));
+                error.raise();
+            }
+        }
+    }
+}
+
 std::string InvokeExpr::walkBytecode(const Expr *lhs, const std::vector<const Expr *> &rhs, Assembler *assembler, const TypeReference& type, Token token1, Token token2) {
     std::string reg = "%error";
     lhs->walkBytecode(assembler);
@@ -837,10 +1177,273 @@ void InvokeExpr::walkBytecode(Assembler* assembler) const {
     reg = walkBytecode(lhs.get(), params, assembler, getType(), token1, token2);
 }
 
+MemoryOrder BuiltinExpr::memoryOrder() const {
+    return order ? MEMORY_ORDERS.at(compiler.of(*order)) : MemoryOrder::SEQ_CST;
+}
+
+bool isAtomicStorable(TypeReference const& type) {
+    return isIntegral(type) || isFloating(type) || isPointer(type);
+}
+
+bool isAtomicArithmetic(TypeReference const& type) {
+    return isIntegral(type) || isFloating(type);
+}
+
+bool isAtomicExchangeable(TypeReference const& type) {
+    return isIntegral(type) || isPointer(type);
+}
+
+bool isAtomic(Builtin builtin) {
+    return builtin <= Builtin::FENCE;
+}
+
+TypeReference BuiltinExpr::evalType(TypeReference const& infer) const {
+    size_t arity;
+    switch (builtin) {
+        case Builtin::FENCE:
+        case Builtin::UNREACHABLE:
+            arity = 0;
+            break;
+        case Builtin::ATOMIC_LOAD:
+        case Builtin::LIKELY:
+        case Builtin::UNLIKELY:
+        case Builtin::ASSUME:
+        case Builtin::LEN:
+            arity = 1;
+            break;
+        case Builtin::ATOMIC_CAS:
+        case Builtin::PREFETCH:
+            arity = 3;
+            break;
+        default:
+            arity = 2;
+            break;
+    }
+    if (rhs.size() != arity) {
+        Error().with(
+                ErrorMessage().error(segment())
+                .text("expected").num(arity).text("parameters but got").num(rhs.size())
+                ).raise();
+    }
+    if (!isAtomic(builtin)) {
+        if (order) {
+            Error().with(
+                    ErrorMessage().error(*order)
+                    .text("memory order is not applicable to").quote(compiler.of(token1))
+                    ).raise();
+        }
+        switch (builtin) {
+            case Builtin::LIKELY:
+            case Builtin::UNLIKELY:
+                rhs[0]->expect(ScalarTypes::BOOL);
+                return ScalarTypes::BOOL;
+            case Builtin::ASSUME:
+                rhs[0]->expect(ScalarTypes::BOOL);
+                return ScalarTypes::NONE;
+            case Builtin::UNREACHABLE:
+                return ScalarTypes::NEVER;
+            case Builtin::PREFETCH:
+                rhs[0]->expect(isPointer, "pointer type");
+                for (size_t i = 1; i < 3; ++i) {
+                    rhs[i]->expect(ScalarTypes::INT);
+                    auto value = rhs[i]->requireConst().$int;
+                    if (value < 0 || value > (i == 1 ? 1 : 3)) {
+                        raise(i == 1 ? "rw must be 0 (read) or 1 (write)" : "locality must be between 0 and 3", rhs[i]->segment());
+                    }
+                }
+                return ScalarTypes::NONE;
+            case Builtin::LEN:
+                rhs[0]->expect(isSlice, "slice type");
+                return ScalarTypes::INT;
+            case Builtin::WRAPPING_ADD:
+            case Builtin::WRAPPING_SUB:
+            case Builtin::WRAPPING_MUL:
+            case Builtin::WRAPPING_SHL:
+                rhs[0]->expect(isIntegral, "integral type");
+                matchOperands(rhs[0].get(), rhs[1].get());
+                return rhs[0]->getType();
+            default:
+                unreachable();
+        }
+    }
+    auto order = memoryOrder();
+    bool disallowed;
+    switch (builtin) {
+        case Builtin::FENCE: disallowed = order == MemoryOrder::RELAXED; break;
+        case Builtin::ATOMIC_LOAD: disallowed = order == MemoryOrder::RELEASE || order == MemoryOrder::ACQ_REL; break;
+        case Builtin::ATOMIC_STORE: disallowed = order == MemoryOrder::ACQUIRE || order == MemoryOrder::ACQ_REL; break;
+        default: disallowed = false; break;
+    }
+    if (disallowed) {
+        Error().with(
+                ErrorMessage().error(*this->order)
+                .text("memory order").quote(compiler.of(*this->order)).text("is not allowed for").quote(compiler.of(token1))
+                ).raise();
+    }
+    if (builtin == Builtin::FENCE) return ScalarTypes::NONE;
+    auto pointer = dynamic_cast<PointerType*>(rhs[0]->getType().get());
+    if (!pointer) rhs[0]->expect("pointer type");
+    auto type = pointer->E;
+    auto check = [&](bool pred(TypeReference const&), const char* expected) {
+        if (!pred(type)) {
+            Error().with(
+                    ErrorMessage().error(rhs[0]->segment())
+                    .text("expected pointer to ").text(expected).text(" but got").type(rhs[0]->getType())
+                    ).raise();
+        }
+    };
+    switch (builtin) {
+        case Builtin::ATOMIC_LOAD:
+        case Builtin::ATOMIC_STORE:
+            check(isAtomicStorable, "arithmetic or pointer type");
+            break;
+        case Builtin::ATOMIC_XCHG:
+        case Builtin::ATOMIC_ADD:
+        case Builtin::ATOMIC_SUB:
+            check(isAtomicArithmetic, "arithmetic type");
+            break;
+        case Builtin::ATOMIC_CAS:
+            check(isAtomicExchangeable, "integral or pointer type");
+            break;
+        default:
+            check(isIntegral, "integral type");
+            break;
+    }
+    if (builtin != Builtin::ATOMIC_LOAD && pointsIntoConstantArray(rhs[0].get())) {
+        raise("constant array is not assignable", rhs[0]->segment());
+    }
+    for (size_t i = 1; i < rhs.size(); ++i) {
+        if (!type->assignableFrom(rhs[i]->getType(type))) {
+            Error().with(
+                    ErrorMessage().error(rhs[i]->segment()).type(rhs[i]->getType()).text("is not assignable to").type(type)
+                    ).raise();
+        }
+    }
+    return builtin == Builtin::ATOMIC_STORE ? ScalarTypes::NONE : type;
+}
+
+std::optional<$union> BuiltinExpr::evalConst() const {
+    switch (builtin) {
+        case Builtin::LIKELY:
+        case Builtin::UNLIKELY:
+            if (!rhs[0]->isConst()) return std::nullopt;
+            return rhs[0]->requireConst();
+        case Builtin::WRAPPING_ADD:
+        case Builtin::WRAPPING_SUB:
+        case Builtin::WRAPPING_MUL:
+        case Builtin::WRAPPING_SHL:
+            if (!rhs[0]->isConst() || !rhs[1]->isConst()) return std::nullopt;
+            return InfixExpr::apply(wrappingOperator(), getType(), rhs[0]->requireConst(), rhs[1]->requireConst(), segment());
+        default:
+            return std::nullopt;
+    }
+}
+
+TokenType BuiltinExpr::wrappingOperator() const {
+    switch (builtin) {
+        case Builtin::WRAPPING_ADD: return TokenType::OP_ADD;
+        case Builtin::WRAPPING_SUB: return TokenType::OP_SUB;
+        case Builtin::WRAPPING_MUL: return TokenType::OP_MUL;
+        case Builtin::WRAPPING_SHL: return TokenType::OP_SHL;
+        default: unreachable();
+    }
+}
+
+std::optional<bool> BuiltinExpr::branchHint(const Expr* cond) {
+    if (auto builtin = dynamic_cast<const BuiltinExpr*>(cond)) {
+        switch (builtin->builtin) {
+            case Builtin::LIKELY: return true;
+            case Builtin::UNLIKELY: return false;
+            default: break;
+        }
+    }
+    return std::nullopt;
+}
+
+void BuiltinExpr::walkBytecode(Assembler* assembler) const {
+    for (auto&& e : rhs) {
+        e->walkBytecode(assembler);
+    }
+    char buf[96];
+    switch (builtin) {
+        case Builtin::LIKELY:
+        case Builtin::UNLIKELY:
+            reg = rhs[0]->reg;
+            return;
+        case Builtin::ASSUME:
+            assembler->assume(rhs[0]->reg, token1);
+            return;
+        case Builtin::UNREACHABLE:
+            assembler->append("unreachable", token1);
+            return;
+        case Builtin::PREFETCH:
+            assembler->declarations.emplace("declare void @llvm.prefetch(ptr, i32, i32, i32)");
+            sprintf(buf, "call void @llvm.prefetch(ptr %s, i32 %lld, i32 %lld, i32 1)", rhs[0]->reg.data(),
+                    (long long) rhs[1]->requireConst().$int, (long long) rhs[2]->requireConst().$int);
+            assembler->append(buf, token1);
+            return;
+        case Builtin::LEN:
+            reg = assembler->extract(rhs[0]->reg, rhs[0]->getType(), 1, token1);
+            return;
+        case Builtin::WRAPPING_ADD:
+            reg = assembler->infix("add", rhs[0]->reg, rhs[1]->reg, getType(), token1);
+            return;
+        case Builtin::WRAPPING_SUB:
+            reg = assembler->infix("sub", rhs[0]->reg, rhs[1]->reg, getType(), token1);
+            return;
+        case Builtin::WRAPPING_MUL:
+            reg = assembler->infix("mul", rhs[0]->reg, rhs[1]->reg, getType(), token1);
+            return;
+        case Builtin::WRAPPING_SHL:
+            reg = assembler->infix("shl", rhs[0]->reg, rhs[1]->reg, getType(), token1);
+            return;
+        default:
+            break;
+    }
+    auto order = memoryOrder();
+    auto desc = MEMORY_ORDER_DESC[(size_t) order];
+    if (builtin == Builtin::FENCE) {
+        assembler->fence(desc, token1);
+        return;
+    }
+    auto type = elementOf(rhs[0]->getType());
+    const char* op;
+    switch (builtin) {
+        case Builtin::ATOMIC_LOAD:
+            reg = assembler->atomicLoad(rhs[0]->reg, type, desc, token1);
+            return;
+        case Builtin::ATOMIC_STORE:
+            assembler->atomicStore(rhs[1]->reg, rhs[0]->reg, type, desc, token1);
+            return;
+        case Builtin::ATOMIC_CAS: {
+            // the failure ordering cannot contain a release
+            MemoryOrder failure;
+            switch (order) {
+                case MemoryOrder::RELEASE: failure = MemoryOrder::RELAXED; break;
+                case MemoryOrder::ACQ_REL: failure = MemoryOrder::ACQUIRE; break;
+                default: failure = order; break;
+            }
+            reg = assembler->cmpxchg(rhs[0]->reg, rhs[1]->reg, rhs[2]->reg, type, desc, MEMORY_ORDER_DESC[(size_t) failure], token1);
+            return;
+        }
+        case Builtin::ATOMIC_XCHG: op = "xchg"; break;
+        case Builtin::ATOMIC_ADD: op = isFloating(type) ? "fadd" : "add"; break;
+        case Builtin::ATOMIC_SUB: op = isFloating(type) ? "fsub" : "sub"; break;
+        case Builtin::ATOMIC_AND: op = "and"; break;
+        case Builtin::ATOMIC_OR: op = "or"; break;
+        case Builtin::ATOMIC_XOR: op = "xor"; break;
+        case Builtin::ATOMIC_MIN: op = isUnsigned(type) ? "umin" : "min"; break;
+        case Builtin::ATOMIC_MAX: op = isUnsigned(type) ? "umax" : "max"; break;
+        default: unreachable();
+    }
+    reg = assembler->atomicrmw(op, rhs[0]->reg, rhs[1]->reg, type, desc, token1);
+}
+
 TypeReference AsExpr::evalType(TypeReference const& infer) const {
     auto type = lhs->getType(T);
     if (T->assignableFrom(type)
-        || isSimilar(isArithmetic, type, T) || isSimilar(isPointerLike, type, T)) return T;
+        || isSimilar(isArithmetic, type, T) || isSimilar(isPointerLike, type, T)
+        || isSlice(type) && isPointer(T)) return T;
     Error().with(
             ErrorMessage().error(segment())
             .text("cannot cast this expression from").type(type).text("to").type(T)
@@ -849,14 +1452,22 @@ TypeReference AsExpr::evalType(TypeReference const& infer) const {
 
 std::optional<$union> AsExpr::evalConst() const {
     if (!lhs->isConst()) return std::nullopt;
-    auto value = lhs->requireConst();
-    if (isInt(lhs->getType())) {
-        if (isFloat(T)) {
-            return (double)value.$int;
+    return apply(lhs->requireConst());
+}
+
+$union AsExpr::apply($union value) const {
+    auto type = lhs->getType();
+    if (isIntegral(type)) {
+        if (isFloating(T)) {
+            return truncate(T, isUnsigned(type) ? (double) value.$size : (double) value.$int);
+        } else if (isIntegral(T)) {
+            return truncate(T, value);
         }
-    } else if (isInt(T)) {
-        if (isFloat(lhs->getType())) {
-            return (int64_t)value.$float;
+    } else if (isFloating(type)) {
+        if (isIntegral(T)) {
+            return truncate(T, isUnsigned(T) ? $union((size_t) value.$float) : $union((int64_t) value.$float));
+        } else if (isFloating(T)) {
+            return truncate(T, value);
         }
     }
     return value;
@@ -870,22 +1481,34 @@ void AsExpr::walkBytecode(Assembler* assembler) const {
         reg = lhs->reg;
         return;
     }
-    if (isInt(type)) {
-        if (isFloat(T)) {
-            reg = assembler->cast("sitofp", lhs->reg, type, T, token);
+    if (isIntegral(type)) {
+        if (isFloating(T)) {
+            reg = assembler->cast(isUnsigned(type) ? "uitofp" : "sitofp", lhs->reg, type, T, token);
+        } else if (isIntegral(T)) {
+            if (T->size() == type->size()) {
+                reg = lhs->reg;
+            } else if (T->size() < type->size()) {
+                reg = assembler->cast("trunc", lhs->reg, type, T, token);
+            } else {
+                reg = assembler->cast(isUnsigned(type) ? "zext" : "sext", lhs->reg, type, T, token);
+            }
         } else if (isPointer(T)) {
             reg = assembler->cast("inttoptr", lhs->reg, type, T, token);
         }
     } else if (isPointer(type)) {
-        if (isInt(T)) {
+        if (isIntegral(T)) {
             reg = assembler->cast("ptrtoint", lhs->reg, type, T, token);
         } else if (isPointer(T)) {
             reg = lhs->reg;
         }
-    } else if (isFloat(type)) {
-        if (isInt(T)) {
-            reg = assembler->cast("fptosi", lhs->reg, type, T, token);
+    } else if (isFloating(type)) {
+        if (isIntegral(T)) {
+            reg = assembler->cast(isUnsigned(T) ? "fptoui" : "fptosi", lhs->reg, type, T, token);
+        } else if (isFloating(T)) {
+            reg = assembler->cast(T->size() > type->size() ? "fpext" : "fptrunc", lhs->reg, type, T, token);
         }
+    } else if (isSlice(type)) {
+        reg = assembler->extract(lhs->reg, type, 0, token);
     }
 }
 
@@ -944,6 +1567,102 @@ std::optional<$union> IfElseExpr::evalConst() const {
     return expr->requireConst();
 }
 
+TypeReference MatchExpr::evalType(TypeReference const& infer) const {
+    auto type = cond->getType();
+    if (!isBool(type) && !isIntegral(type)) cond->expect("integral type or bool");
+    std::vector<std::pair<$union, const Expr*>> seen;
+    for (auto&& arm : arms) {
+        for (auto&& label : arm.labels) {
+            if (!label->getType(type)->equals(type)) label->expect(type);
+            auto value = label->requireConst();
+            for (auto&& [previous, expr] : seen) {
+                if (isBool(type) ? previous.$bool == value.$bool : previous.$size == value.$size) {
+                    Error error;
+                    error.with(ErrorMessage().error(label->segment()).text("duplicate label in match"));
+                    error.with(ErrorMessage().note(expr->segment()).text("previously appeared here"));
+                    error.raise();
+                }
+            }
+            seen.emplace_back(value, label.get());
+        }
+    }
+    if (!otherwise) {
+        size_t values = isBool(type) ? 2 : type->size() < 8 ? size_t(1) << type->size() * 8 : 0;
+        if (seen.size() != values) {
+            raise("match is not exhaustive, an else arm is required", segment());
+        }
+    }
+    TypeReference result = otherwise ? otherwise->getType(infer) : ScalarTypes::NEVER;
+    const Expr* first = otherwise.get();
+    for (auto&& arm : arms) {
+        auto value = arm.value.get();
+        if (!first) first = value;
+        if (auto either = eithertype(result, value->getType(infer))) {
+            result = either;
+        } else {
+            Error error;
+            error.with(ErrorMessage().error(value->segment()).text("type mismatch on arms of match"));
+            error.with(ErrorMessage().note(value->segment()).text("type of this arm is").type(value->getType()));
+            error.with(ErrorMessage().note(first->segment()).text("type of other arms is").type(result));
+            error.raise();
+        }
+    }
+    return result;
+}
+
+const Expr* MatchExpr::select($union value) const {
+    bool b = isBool(cond->getType());
+    for (auto&& arm : arms) {
+        for (auto&& label : arm.labels) {
+            auto expected = label->requireConst();
+            if (b ? expected.$bool == value.$bool : expected.$size == value.$size) return arm.value.get();
+        }
+    }
+    return otherwise.get();
+}
+
+std::optional<$union> MatchExpr::evalConst() const {
+    if (!cond->isConst()) return std::nullopt;
+    auto expr = select(cond->requireConst());
+    if (!expr || !expr->isConst()) return std::nullopt;
+    return expr->requireConst();
+}
+
+void MatchExpr::walkBytecode(Assembler* assembler) const {
+    auto type = getType();
+    auto condType = cond->getType();
+    bool store = !isNone(type) && !isNever(type);
+    auto result = store ? assembler->alloca_(type) : "%error";
+    cond->walkBytecode(assembler);
+    size_t end = compiler.global->labelUntil++;
+    std::vector<size_t> targets;
+    std::vector<std::pair<std::string, size_t>> cases;
+    for (auto&& arm : arms) {
+        targets.push_back(compiler.global->labelUntil++);
+        for (auto&& label : arm.labels) {
+            cases.emplace_back(Assembler::const_(label->requireConst(), condType), targets.back());
+        }
+    }
+    // an exhaustive match takes its last arm as the default destination
+    size_t fallback = otherwise ? compiler.global->labelUntil++ : targets.back();
+    assembler->switch_(cond->reg, condType, fallback, cases, token1);
+    auto walkArm = [&](const Expr* value, size_t label) {
+        assembler->label(label);
+        value->walkBytecode(assembler);
+        if (isNever(value->getType())) return;
+        if (store) assembler->store(value->reg, result, type, token1);
+        assembler->br(end);
+    };
+    for (size_t i = 0; i < arms.size(); ++i) {
+        walkArm(arms[i].value.get(), targets[i]);
+    }
+    if (otherwise) walkArm(otherwise.get(), fallback);
+    reg = result;
+    if (isNever(type)) return;
+    assembler->label(end);
+    if (store) reg = assembler->load(result, type, token2);
+}
+
 void IfElseExpr::walkBytecode(Assembler* assembler) const {
     reg = walkBytecode(cond.get(), lhs.get(), rhs.get(), compiler, assembler, getType(), token);
 }
@@ -955,7 +1674,7 @@ std::string IfElseExpr::walkBytecode(Expr const* cond, Expr const* lhs, Expr con
     bool store = !isNone(type);
     auto reg = store ? assembler->alloca_(type) : "%error";
     cond->walkBytecode(assembler);
-    assembler->br(cond->reg, A, B);
+    assembler->br(cond->reg, A, B, BuiltinExpr::branchHint(cond));
     assembler->label(A);
     lhs->walkBytecode(assembler);
     if (store && !isNever(lhs->getType())) assembler->store(lhs->reg, reg, type, token);
@@ -983,6 +1702,7 @@ void BreakExpr::walkBytecode(Assembler* assembler) const {
 TypeReference WhileExpr::evalType(TypeReference const& infer) const {
     if (isNever(cond->getType())) return ScalarTypes::NEVER;
     cond->expect(ScalarTypes::BOOL);
+    clause->getType();
     if (cond->isConst() && cond->requireConst().$bool && hook->breaks.empty())
         return ScalarTypes::NEVER;
     return ScalarTypes::NONE;
@@ -996,7 +1716,7 @@ void WhileExpr::walkBytecode(Assembler* assembler) const {
     assembler->br(A);
     assembler->label(A);
     cond->walkBytecode(assembler);
-    assembler->br(cond->reg, B, C);
+    assembler->br(cond->reg, B, C, BuiltinExpr::branchHint(cond.get()));
     assembler->label(B);
     clause->walkBytecode(assembler);
     if (!isNever(clause->getType())) {
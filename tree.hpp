@@ -12,8 +12,83 @@ struct IdExpr;
 using ExprHandle = std::unique_ptr<Expr>;
 using IdExprHandle = std::unique_ptr<IdExpr>;
 struct SimpleDeclarator;
+struct ExportedLet;
 using DeclaratorHandle = std::unique_ptr<SimpleDeclarator>;
 
+enum class Builtin {
+    ATOMIC_LOAD,
+    ATOMIC_STORE,
+    ATOMIC_XCHG,
+    ATOMIC_ADD,
+    ATOMIC_SUB,
+    ATOMIC_AND,
+    ATOMIC_OR,
+    ATOMIC_XOR,
+    ATOMIC_MIN,
+    ATOMIC_MAX,
+    ATOMIC_CAS,
+    FENCE,
+    LIKELY,
+    UNLIKELY,
+    ASSUME,
+    UNREACHABLE,
+    PREFETCH,
+    LEN,
+    WRAPPING_ADD,
+    WRAPPING_SUB,
+    WRAPPING_MUL,
+    WRAPPING_SHL,
+};
+
+const std::unordered_map<std::string_view, Builtin> BUILTINS {
+    {"atomic_load",  Builtin::ATOMIC_LOAD},
+    {"atomic_store", Builtin::ATOMIC_STORE},
+    {"atomic_xchg",  Builtin::ATOMIC_XCHG},
+    {"atomic_add",   Builtin::ATOMIC_ADD},
+    {"atomic_sub",   Builtin::ATOMIC_SUB},
+    {"atomic_and",   Builtin::ATOMIC_AND},
+    {"atomic_or",    Builtin::ATOMIC_OR},
+    {"atomic_xor",   Builtin::ATOMIC_XOR},
+    {"atomic_min",   Builtin::ATOMIC_MIN},
+    {"atomic_max",   Builtin::ATOMIC_MAX},
+    {"atomic_cas",   Builtin::ATOMIC_CAS},
+    {"fence",        Builtin::FENCE},
+    {"likely",       Builtin::LIKELY},
+    {"unlikely",     Builtin::UNLIKELY},
+    {"assume",       Builtin::ASSUME},
+    {"unreachable",  Builtin::UNREACHABLE},
+    {"prefetch",     Builtin::PREFETCH},
+    {"len",          Builtin::LEN},
+    {"wrapping_add", Builtin::WRAPPING_ADD},
+    {"wrapping_sub", Builtin::WRAPPING_SUB},
+    {"wrapping_mul", Builtin::WRAPPING_MUL},
+    {"wrapping_shl", Builtin::WRAPPING_SHL},
+};
+
+enum class MemoryOrder {
+    RELAXED,
+    ACQUIRE,
+    RELEASE,
+    ACQ_REL,
+    SEQ_CST,
+};
+
+const std::unordered_map<std::string_view, MemoryOrder> MEMORY_ORDERS {
+    {"relaxed", MemoryOrder::RELAXED},
+    {"acquire", MemoryOrder::ACQUIRE},
+    {"release", MemoryOrder::RELEASE},
+    {"acq_rel", MemoryOrder::ACQ_REL},
+    {"seq_cst", MemoryOrder::SEQ_CST},
+};
+
+constexpr const char* MEMORY_ORDER_DESC[] = {
+    "monotonic",
+    "acquire",
+    "release",
+    "acq_rel",
+    "seq_cst",
+};
+
 struct Expr : Descriptor {
     enum class Level {
         ASSIGNMENT,
@@ -60,6 +135,8 @@ struct Expr : Descriptor {
 
     std::optional<$union> getConst() const {
         if (constState == ConstState::INDETERMINATE) {
+            // an expression depending on itself, like a recursive call, is not constant
+            constState = ConstState::RUNTIME;
             if (auto value = evalConst()) {
                 constValue = value.value();
                 constState = ConstState::CONSTANT;
@@ -173,6 +250,32 @@ struct SizeofExpr : Expr {
     }
 };
 
+struct ArrayExpr : Expr {
+    Token token1, token2;
+    std::vector<ExprHandle> elements;
+
+    ArrayExpr(Compiler& compiler, Token token1, Token token2, std::vector<ExprHandle> elements): Expr(compiler),
+        token1(token1), token2(token2), elements(std::move(elements)) {}
+
+    [[nodiscard]] std::vector<const Descriptor*> children() const override {
+        std::vector<const Descriptor*> ret;
+        for (auto&& e : elements) ret.push_back(e.get());
+        return ret;
+    }
+    [[nodiscard]] std::string_view descriptor() const noexcept override { return "[]"; }
+
+    [[nodiscard]] Segment segment() const override {
+        return range(token1, token2);
+    }
+
+    [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
+
+    // the constant global holding the elements, like "unnamed_addr constant [2 x i64] [i64 1, i64 2], align 16"
+    [[nodiscard]] std::string definition(Assembler* assembler) const;
+
+    void walkBytecode(Assembler* assembler) const override;
+};
+
 struct AssignableExpr : Expr {
     explicit AssignableExpr(Compiler& compiler): Expr(compiler) {}
 
@@ -200,6 +303,12 @@ struct IdExpr : AssignableExpr {
         lookup = context.lookup(compiler, token);
     }
 
+    // a global constant array is named by its address, so it is never loaded or stored
+    [[nodiscard]] bool isConstantArray() const;
+
+    // the global is imported from another file
+    [[nodiscard]] const ExportedLet* importedLet() const;
+
     [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
 
     [[nodiscard]] std::optional<$union> evalConst() const override;
@@ -228,6 +337,8 @@ struct PrefixExpr : Expr {
 
     [[nodiscard]] std::optional<$union> evalConst() const override;
 
+    [[nodiscard]] $union apply($union value) const;
+
     void walkBytecode(Assembler* assembler) const override;
 };
 
@@ -329,6 +440,8 @@ struct InfixExpr : InfixExprBase {
 
     [[nodiscard]] std::optional<$union> evalConst() const override;
 
+    [[nodiscard]] static $union apply(TokenType op, TypeReference const& type, $union value1, $union value2, Segment segment);
+
     void walkBytecode(Assembler* assembler) const override;
 };
 
@@ -340,6 +453,8 @@ struct CompareExpr : InfixExprBase {
 
     [[nodiscard]] std::optional<$union> evalConst() const override;
 
+    [[nodiscard]] $union apply($union value1, $union value2) const;
+
     void walkBytecode(Assembler* assembler) const override;
 };
 
@@ -362,6 +477,8 @@ struct InfixInvokeExpr : InfixExprBase {
 
     [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
 
+    [[nodiscard]] std::optional<$union> evalConst() const override;
+
     void walkBytecode(Assembler* assembler) const override;
 };
 
@@ -407,6 +524,32 @@ struct AccessExpr : AssignableExpr {
     std::string addressOf(Assembler* assembler) const override;
 };
 
+struct SliceExpr : Expr {
+    Token token1, token2;
+    ExprHandle lhs;
+    ExprHandle begin; // nullable, defaults to 0
+    ExprHandle end;   // nullable, defaults to the length of a slice
+
+    SliceExpr(Compiler& compiler, Token token1, Token token2, ExprHandle lhs, ExprHandle begin, ExprHandle end): Expr(compiler),
+        token1(token1), token2(token2), lhs(std::move(lhs)), begin(std::move(begin)), end(std::move(end)) {}
+
+    [[nodiscard]] std::vector<const Descriptor*> children() const override {
+        std::vector<const Descriptor*> children{lhs.get()};
+        if (begin) children.push_back(begin.get());
+        if (end) children.push_back(end.get());
+        return children;
+    }
+    [[nodiscard]] std::string_view descriptor() const noexcept override { return "[:]"; }
+
+    [[nodiscard]] Segment segment() const override {
+        return range(lhs->segment(), token2);
+    }
+
+    [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
+
+    void walkBytecode(Assembler* assembler) const override;
+};
+
 struct InvokeExpr : Expr {
     Token token1, token2;
     ExprHandle lhs;
@@ -428,11 +571,52 @@ struct InvokeExpr : Expr {
 
     [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
 
+    [[nodiscard]] std::optional<$union> evalConst() const override;
+
+    static std::optional<$union> evalConst(const Expr* lhs, std::vector<const Expr*> const& rhs);
+
+    static void checkRestrict(FuncType const* func, std::vector<const Expr*> const& rhs);
+
     static std::string walkBytecode(const Expr *lhs, const std::vector<const Expr *> &rhs, Assembler *assembler, const TypeReference& type, Token token1, Token token2);
 
     void walkBytecode(Assembler* assembler) const override;
 };
 
+struct BuiltinExpr : Expr {
+    Token token1, token2;
+    Builtin builtin;
+    std::vector<ExprHandle> rhs;
+    std::optional<Token> order;
+
+    BuiltinExpr(Compiler& compiler, Token token1, Token token2, Builtin builtin, std::vector<ExprHandle> rhs, std::optional<Token> order): Expr(compiler),
+        token1(token1), token2(token2), builtin(builtin), rhs(std::move(rhs)), order(order) {}
+
+    [[nodiscard]] std::vector<const Descriptor*> children() const override {
+        std::vector<const Descriptor*> ret;
+        for (auto&& e : rhs) ret.push_back(e.get());
+        return ret;
+    }
+    [[nodiscard]] std::string_view descriptor() const noexcept override { return compiler.of(token1); }
+
+    [[nodiscard]] Segment segment() const override {
+        return range(token1, token2);
+    }
+
+    [[nodiscard]] MemoryOrder memoryOrder() const;
+
+    // the operator a wrapping_* builtin computes without the no-overflow assumption
+    [[nodiscard]] TokenType wrappingOperator() const;
+
+    [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
+
+    [[nodiscard]] std::optional<$union> evalConst() const override;
+
+    // true for likely(cond), false for unlikely(cond)
+    static std::optional<bool> branchHint(const Expr* cond);
+
+    void walkBytecode(Assembler* assembler) const override;
+};
+
 struct AsExpr : Expr {
     Token token, token2;
     ExprHandle lhs;
@@ -452,6 +636,8 @@ struct AsExpr : Expr {
 
     [[nodiscard]] std::optional<$union> evalConst() const override;
 
+    [[nodiscard]] $union apply($union value) const;
+
     void walkBytecode(Assembler* assembler) const override;
 };
 
@@ -505,6 +691,45 @@ struct IfElseExpr : Expr {
     [[nodiscard]] static std::string walkBytecode(Expr const* cond, Expr const* lhs, Expr const* rhs, Compiler& compiler, Assembler* assembler, const TypeReference& type, Token token);
 };
 
+struct MatchExpr : Expr {
+    struct Arm {
+        std::vector<ExprHandle> labels;
+        ExprHandle value;
+    };
+
+    Token token1, token2;
+    ExprHandle cond;
+    std::vector<Arm> arms;
+    ExprHandle otherwise; // nullable, the else arm
+
+    MatchExpr(Compiler& compiler, Token token1, Token token2, ExprHandle cond, std::vector<Arm> arms, ExprHandle otherwise): Expr(compiler),
+        token1(token1), token2(token2), cond(std::move(cond)), arms(std::move(arms)), otherwise(std::move(otherwise)) {}
+
+    [[nodiscard]] std::vector<const Descriptor*> children() const override {
+        std::vector<const Descriptor*> children{cond.get()};
+        for (auto&& arm : arms) {
+            for (auto&& label : arm.labels) children.push_back(label.get());
+            children.push_back(arm.value.get());
+        }
+        if (otherwise) children.push_back(otherwise.get());
+        return children;
+    }
+    [[nodiscard]] std::string_view descriptor() const noexcept override { return "match"; }
+
+    [[nodiscard]] Segment segment() const override {
+        return range(token1, token2);
+    }
+
+    [[nodiscard]] TypeReference evalType(TypeReference const& infer) const override;
+
+    [[nodiscard]] std::optional<$union> evalConst() const override;
+
+    // the arm taken when cond evaluates to value
+    [[nodiscard]] const Expr* select($union value) const;
+
+    void walkBytecode(Assembler* assembler) const override;
+};
+
 struct LoopHook;
 struct LoopExpr;
 
@@ -607,6 +832,7 @@ struct ParameterList : Descriptor {
 struct FunctionDefinition : Descriptor {
     ExprHandle clause;
     std::vector<TypeReference> locals;
+    bool fast = false; // annotated with @fast
 
     FunctionDefinition(ExprHandle clause, std::vector<TypeReference> locals)
             : clause(std::move(clause)), locals(std::move(locals)) {}
@@ -650,9 +876,10 @@ struct Declarator : Descriptor {
 struct SimpleDeclarator : Declarator {
     IdExprHandle name;
     TypeReference designated;
+    bool restricted;
 
-    SimpleDeclarator(Compiler& compiler, Segment segment, IdExprHandle name, TypeReference designated)
-        : Declarator(compiler, segment), name(std::move(name)), designated(std::move(designated))
+    SimpleDeclarator(Compiler& compiler, Segment segment, IdExprHandle name, TypeReference designated, bool restricted = false)
+        : Declarator(compiler, segment), name(std::move(name)), designated(std::move(designated)), restricted(restricted)
         { typeCache = this->designated; }
 
     [[nodiscard]] std::string_view descriptor() const noexcept override { return ":"; }
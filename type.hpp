@@ -15,7 +15,15 @@ enum class ScalarTypeKind {
     NONE,
     NEVER,
     BOOL,
+    I8,
+    I16,
+    I32,
     INT,
+    U8,
+    U16,
+    U32,
+    U64,
+    F32,
     FLOAT,
 };
 
@@ -23,7 +31,15 @@ constexpr std::string_view SCALAR_TYPE_NAME[] = {
     "none",
     "never",
     "bool",
+    "i8",
+    "i16",
+    "i32",
     "int",
+    "u8",
+    "u16",
+    "u32",
+    "u64",
+    "f32",
     "float",
 };
 
@@ -31,7 +47,15 @@ constexpr std::string_view SCALAR_TYPE_DESC[] = {
     "void",
     "void",
     "i1",
+    "i8",
+    "i16",
+    "i32",
     "i64",
+    "i8",
+    "i16",
+    "i32",
+    "i64",
+    "float",
     "double",
 };
 
@@ -39,7 +63,15 @@ const std::unordered_map<std::string_view, ScalarTypeKind> SCALAR_TYPES {
     {"none",   ScalarTypeKind::NONE},
     {"never",  ScalarTypeKind::NEVER},
     {"bool",   ScalarTypeKind::BOOL},
+    {"i8",     ScalarTypeKind::I8},
+    {"i16",    ScalarTypeKind::I16},
+    {"i32",    ScalarTypeKind::I32},
     {"int",    ScalarTypeKind::INT},
+    {"u8",     ScalarTypeKind::U8},
+    {"u16",    ScalarTypeKind::U16},
+    {"u32",    ScalarTypeKind::U32},
+    {"u64",    ScalarTypeKind::U64},
+    {"f32",    ScalarTypeKind::F32},
     {"float",  ScalarTypeKind::FLOAT},
 };
 
@@ -47,7 +79,15 @@ constexpr int64_t SIZEOF_SCALAR[] = {
         0,
         0,
         1,
+        1,
+        2,
+        4,
         8,
+        1,
+        2,
+        4,
+        8,
+        4,
         8
 };
 
@@ -146,12 +186,28 @@ const TypeReference FLOAT = std::make_shared<ScalarType>(ScalarTypeKind::FLOAT);
     return isScalar(type, ScalarTypeKind::FLOAT);
 }
 
+[[nodiscard]] inline bool isSigned(TypeReference const& type) noexcept {
+    return isScalar(type, [](ScalarTypeKind kind) noexcept { return ScalarTypeKind::I8 <= kind && kind <= ScalarTypeKind::INT; });
+}
+
+[[nodiscard]] inline bool isUnsigned(TypeReference const& type) noexcept {
+    return isScalar(type, [](ScalarTypeKind kind) noexcept { return ScalarTypeKind::U8 <= kind && kind <= ScalarTypeKind::U64; });
+}
+
+[[nodiscard]] inline bool isIntegral(TypeReference const& type) noexcept {
+    return isSigned(type) || isUnsigned(type);
+}
+
+[[nodiscard]] inline bool isFloating(TypeReference const& type) noexcept {
+    return isScalar(type, [](ScalarTypeKind kind) noexcept { return kind == ScalarTypeKind::F32 || kind == ScalarTypeKind::FLOAT; });
+}
+
 [[nodiscard]] inline bool isSimilar(bool pred(TypeReference const&), TypeReference const& type1, TypeReference const& type2) noexcept {
     return pred(type1) && pred(type2);
 }
 
 [[nodiscard]] inline bool isArithmetic(TypeReference const& type) noexcept {
-    return isScalar(type, [](ScalarTypeKind kind) noexcept { return kind == ScalarTypeKind::INT || kind == ScalarTypeKind::FLOAT; });
+    return isIntegral(type) || isFloating(type);
 }
 
 struct PointerType : Type {
@@ -183,27 +239,91 @@ struct PointerType : Type {
     }
 };
 
+struct SliceType : Type {
+    TypeReference E;
+
+    explicit SliceType(TypeReference E): E(std::move(E)) {}
+
+    [[nodiscard]] std::string toString() const override {
+        return "[]" + E->toString();
+    }
+
+    [[nodiscard]] bool equals(const TypeReference& type) const noexcept override {
+        if (this == type.get()) return true;
+        if (auto slice = dynamic_cast<const SliceType*>(type.get())) {
+            return slice->E->equals(E);
+        }
+        return false;
+    }
+
+    [[nodiscard]] std::vector<const Descriptor*> children() const override { return {E.get()}; }
+    [[nodiscard]] std::string_view descriptor() const noexcept override { return "[]"; }
+
+    [[nodiscard]] std::string serialize() const override {
+        return "{ ptr, i64 }";
+    }
+
+    [[nodiscard]] int64_t size() const override {
+        return 16;
+    }
+};
 
 [[nodiscard]] inline bool isPointer(TypeReference const& type) noexcept {
     return dynamic_cast<PointerType*>(type.get());
 }
 
+[[nodiscard]] inline bool isSlice(TypeReference const& type) noexcept {
+    return dynamic_cast<SliceType*>(type.get());
+}
+
 [[nodiscard]] inline bool isPointerLike(TypeReference const& type) noexcept {
-    return isPointer(type) || isInt(type);
+    return isPointer(type) || isInt(type) || isScalar(type, ScalarTypeKind::U64);
 }
 
+enum class FunctionAttribute {
+    READNONE,
+    READONLY,
+    NOUNWIND,
+    WILLRETURN,
+    NORECURSE,
+};
+
+constexpr std::string_view FUNCTION_ATTRIBUTE_NAME[] = {
+    "readnone",
+    "readonly",
+    "nounwind",
+    "willreturn",
+    "norecurse",
+};
+
 struct FuncType : Type {
     std::vector<TypeReference> P;
     TypeReference R;
+    std::vector<bool> restricts; // empty if no parameter is restrict-qualified
+    unsigned attributes = 0; // bitset of FunctionAttribute, only meaningful for global functions
+
+    explicit FuncType(std::vector<TypeReference> P, TypeReference R, std::vector<bool> restricts = {}):
+        P(std::move(P)), R(std::move(R)), restricts(std::move(restricts)) {}
+
+    [[nodiscard]] bool isRestrict(size_t index) const noexcept {
+        return index < restricts.size() && restricts[index];
+    }
+
+    [[nodiscard]] bool has(FunctionAttribute attribute) const noexcept {
+        return attributes & 1u << (unsigned) attribute;
+    }
 
-    explicit FuncType(std::vector<TypeReference> P, TypeReference R): P(std::move(P)), R(std::move(R)) {}
+    void add(FunctionAttribute attribute) noexcept {
+        attributes |= 1u << (unsigned) attribute;
+    }
 
     [[nodiscard]] std::string toString() const override {
         std::string buf = "(";
         bool first = true;
-        for (auto&& p : P) {
+        for (size_t i = 0; i < P.size(); ++i) {
             if (first) { first = false; } else { buf += ", "; }
-            buf += p->toString();
+            if (isRestrict(i)) buf += "restrict ";
+            buf += P[i]->toString();
         }
         buf += "): ";
         buf += R->toString();
@@ -274,4 +394,20 @@ union $union {
     $union(double $float): $float($float) {}
 };
 
+[[nodiscard]] inline $union truncate(TypeReference const& type, $union value) noexcept {
+    if (auto scalar = dynamic_cast<ScalarType*>(type.get())) {
+        switch (scalar->S) {
+            case ScalarTypeKind::I8: return (int64_t) (int8_t) value.$int;
+            case ScalarTypeKind::I16: return (int64_t) (int16_t) value.$int;
+            case ScalarTypeKind::I32: return (int64_t) (int32_t) value.$int;
+            case ScalarTypeKind::U8: return (int64_t) (uint8_t) value.$int;
+            case ScalarTypeKind::U16: return (int64_t) (uint16_t) value.$int;
+            case ScalarTypeKind::U32: return (int64_t) (uint32_t) value.$int;
+            case ScalarTypeKind::F32: return (double) (float) value.$float;
+            default: break;
+        }
+    }
+    return value;
+}
+
 }